@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+/*
+ * Арена — ресурс памяти, выделяющий память последовательно из блоков и
+ * никогда не освобождающий отдельные выделения
+ * В отличие от std::pmr::monotonic_buffer_resource блоки не возвращаются
+ * вышестоящему ресурсу при сбросе: Reset за O(1) делает всю память арены
+ * снова доступной, и следующий цикл выделений повторно использует уже
+ * полученные блоки
+ * Арена не синхронизирована
+ */
+class ArenaResource : public std::pmr::memory_resource {
+ public:
+  explicit ArenaResource(
+      size_t initial_block_bytes = 4096,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : initial_block_bytes_(std::max(initial_block_bytes, kMinBlockBytes)),
+        next_block_bytes_(initial_block_bytes_),
+        upstream_(upstream) {}
+
+  ArenaResource(const ArenaResource &) = delete;
+  ArenaResource &operator=(const ArenaResource &) = delete;
+
+  ~ArenaResource() override { Release(); }
+
+  // Делает недействительной всю выделенную из арены память, сохраняя блоки
+  // для повторного использования. Выполняется за O(1)
+  void Reset() noexcept {
+    current_ = blocks_;
+    if (current_ != nullptr) {
+      cursor_ = current_->Data();
+      end_ = current_->End();
+    } else {
+      cursor_ = nullptr;
+      end_ = nullptr;
+    }
+  }
+
+  // Возвращает все блоки вышестоящему ресурсу
+  void Release() noexcept {
+    while (blocks_ != nullptr) {
+      BlockHeader *block = blocks_;
+      blocks_ = block->next;
+      upstream_->deallocate(block, block->bytes, alignof(std::max_align_t));
+    }
+    current_ = nullptr;
+    cursor_ = nullptr;
+    end_ = nullptr;
+    block_count_ = 0;
+  }
+
+  // Возвращает количество блоков, полученных от вышестоящего ресурса
+  [[nodiscard]] size_t GetBlockCount() const noexcept { return block_count_; }
+
+  // Возвращает размер первого блока арены
+  [[nodiscard]] size_t GetInitialBlockBytes() const noexcept {
+    return initial_block_bytes_;
+  }
+
+  [[nodiscard]] std::pmr::memory_resource *GetUpstream() const noexcept {
+    return upstream_;
+  }
+
+ private:
+  static constexpr size_t kMinBlockBytes = 256;
+
+  // Заголовок блока, за которым следует память для выделений
+  struct alignas(std::max_align_t) BlockHeader {
+    BlockHeader *next;
+    size_t bytes;
+
+    std::byte *Data() noexcept {
+      return reinterpret_cast<std::byte *>(this + 1);
+    }
+    std::byte *End() noexcept {
+      return reinterpret_cast<std::byte *>(this) + bytes;
+    }
+  };
+
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    while (true) {
+      if (void *p = TryAllocate(bytes, alignment)) {
+        return p;
+      }
+      // Текущий блок исчерпан: переходим к следующему уже полученному блоку
+      // или запрашиваем новый
+      if (current_ != nullptr && current_->next != nullptr) {
+        current_ = current_->next;
+      } else {
+        AppendBlock(bytes + alignment);
+      }
+      cursor_ = current_->Data();
+      end_ = current_->End();
+    }
+  }
+
+  // Отдельные выделения не освобождаются: память возвращается при Reset
+  void do_deallocate(void *, size_t, size_t) noexcept override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  void *TryAllocate(size_t bytes, size_t alignment) noexcept {
+    if (cursor_ == nullptr) {
+      return nullptr;
+    }
+    void *p = cursor_;
+    size_t space = static_cast<size_t>(end_ - cursor_);
+    if (std::align(alignment, bytes, p, space) == nullptr) {
+      return nullptr;
+    }
+    cursor_ = static_cast<std::byte *>(p) + bytes;
+    return p;
+  }
+
+  // Добавляет в конец цепочки блок, вмещающий не менее min_bytes. Размеры
+  // блоков растут геометрически
+  void AppendBlock(size_t min_bytes) {
+    const size_t bytes =
+        std::max(next_block_bytes_, min_bytes + sizeof(BlockHeader));
+    auto *block = ::new (upstream_->allocate(bytes, alignof(std::max_align_t)))
+        BlockHeader{nullptr, bytes};
+    if (current_ != nullptr) {
+      current_->next = block;
+    } else {
+      blocks_ = block;
+    }
+    current_ = block;
+    ++block_count_;
+    next_block_bytes_ = bytes * 2;
+  }
+
+  size_t initial_block_bytes_;
+  size_t next_block_bytes_;
+  std::pmr::memory_resource *upstream_;
+  BlockHeader *blocks_ = nullptr;
+  // Блок, из которого выполняются выделения, и его свободная часть
+  BlockHeader *current_ = nullptr;
+  std::byte *cursor_ = nullptr;
+  std::byte *end_ = nullptr;
+  size_t block_count_ = 0;
+};
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "arena_resource.h"
+#include "single_linked_list.h"
+
+namespace detail {
+
+// Владелец арены. Базовый класс ArenaSingleLinkedList, стоящий перед
+// списком, чтобы арена была создана раньше списка и разрушена позже него
+struct ArenaHolder {
+  explicit ArenaHolder(size_t initial_block_bytes,
+                       std::pmr::memory_resource *upstream)
+      : arena(initial_block_bytes, upstream) {}
+
+  ArenaResource arena;
+};
+
+}  // namespace detail
+
+/*
+ * Односвязный список, узлы которого размещаются в собственной арене
+ * Узлы не освобождаются по одному: память всех узлов возвращается арене
+ * разом. Для типов с тривиальным деструктором Clear и деструктор выполняются
+ * за O(1), не обходя список. Элементы остальных типов по-прежнему
+ * разрушаются, после чего арена сбрасывается
+ * Память узлов, удалённых через PopFront или EraseAfter, становится снова
+ * доступной только после Clear, поэтому список предназначен для данных,
+ * которые создаются и уничтожаются целиком, например в пределах обработки
+ * одного запроса
+ * Арена принадлежит списку, поэтому список нельзя перемещать
+ * Список наследует pmr::SingleLinkedList закрыто и не предоставляет
+ * операций, передающих узлы другому списку (swap, SpliceAfter, Merge), а
+ * также преобразования к pmr::SingleLinkedList: иначе узлы из арены
+ * оказались бы в списке, который переживёт арену
+ * Compact не предоставляется: узлы и так размещаются в арене подряд, а
+ * память прежних узлов не вернулась бы в арену до Clear
+ */
+template <typename Type>
+class ArenaSingleLinkedList : private detail::ArenaHolder,
+                              private pmr::SingleLinkedList<Type> {
+  using Base = pmr::SingleLinkedList<Type>;
+
+  template <typename T>
+  friend bool operator==(const ArenaSingleLinkedList<T> &lhs,
+                         const ArenaSingleLinkedList<T> &rhs);
+  template <typename T>
+  friend detail::ThreeWayResult CompareThreeWay(
+      const ArenaSingleLinkedList<T> &lhs, const ArenaSingleLinkedList<T> &rhs);
+
+ public:
+  using typename Base::allocator_type;
+  using typename Base::const_reference;
+  using typename Base::ConstIterator;
+  using typename Base::Iterator;
+  using typename Base::reference;
+  using typename Base::value_type;
+
+  using Base::begin;
+  using Base::cbegin;
+  using Base::cend;
+  using Base::end;
+
+  using Base::before_begin;
+  using Base::cbefore_begin;
+
+  using Base::get_allocator;
+  using Base::GetStats;
+  using Base::ResetStats;
+
+  using Base::GetSize;
+  using Base::IsEmpty;
+
+  using Base::ForEach;
+
+  using Base::EmplaceBack;
+  using Base::EmplaceFront;
+  using Base::PushBack;
+  using Base::PushFront;
+
+  using Base::AppendFrom;
+  using Base::AppendRange;
+  using Base::Assign;
+  using Base::kDefaultAppendBatch;
+
+  using Base::GetCapacity;
+  using Base::Reserve;
+  using Base::ShrinkToFit;
+
+  using Base::MeasureLocality;
+
+  using Base::EmplaceAfter;
+  using Base::InsertAfter;
+  using Base::PopFront;
+
+  using Base::Sort;
+
+  // Размер первого блока арены по умолчанию
+  static constexpr size_t kDefaultBlockBytes = 4096;
+
+  explicit ArenaSingleLinkedList(
+      size_t initial_block_bytes = kDefaultBlockBytes,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : ArenaHolder(initial_block_bytes, upstream), Base(&arena) {}
+
+  ArenaSingleLinkedList(std::initializer_list<Type> values)
+      : ArenaSingleLinkedList() {
+    Base::Assign(values);
+  }
+
+  // Копия размещает элементы в собственной арене с тем же размером первого
+  // блока
+  ArenaSingleLinkedList(const ArenaSingleLinkedList &other)
+      : ArenaHolder(other.arena.GetInitialBlockBytes(),
+                    other.arena.GetUpstream()),
+        Base(other, &arena) {}
+
+  ArenaSingleLinkedList &operator=(const ArenaSingleLinkedList &rhs) {
+    Base::operator=(rhs);
+    return *this;
+  }
+
+  ArenaSingleLinkedList(ArenaSingleLinkedList &&) = delete;
+  ArenaSingleLinkedList &operator=(ArenaSingleLinkedList &&) = delete;
+
+  ~ArenaSingleLinkedList() { Clear(); }
+
+  // Удаляет все элементы и делает всю память арены снова доступной
+  void Clear() noexcept {
+    if constexpr (std::is_trivially_destructible_v<Type>) {
+      Base::AbandonNodes();
+    } else {
+      Base::Clear();
+      Base::ShrinkToFit();
+    }
+    arena.Reset();
+  }
+
+  // Удаление элементов. Перегрузки, переносящие удалённые узлы в другой
+  // список, не предоставляются
+  Iterator EraseAfter(ConstIterator pos) noexcept {
+    return Base::EraseAfter(pos);
+  }
+
+  size_t EraseAfter(ConstIterator first, ConstIterator last) noexcept {
+    return Base::EraseAfter(first, last);
+  }
+
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred) {
+    return Base::RemoveIf(std::move(pred));
+  }
+
+  size_t Remove(const Type &value) { return Base::Remove(value); }
+
+  template <typename BinaryPredicate>
+  size_t Unique(BinaryPredicate pred) {
+    return Base::Unique(std::move(pred));
+  }
+
+  size_t Unique() { return Base::Unique(); }
+
+  [[nodiscard]] const ArenaResource &GetArena() const noexcept {
+    return arena;
+  }
+};
+
+template <typename Type>
+bool operator==(const ArenaSingleLinkedList<Type> &lhs,
+                const ArenaSingleLinkedList<Type> &rhs) {
+  return static_cast<const pmr::SingleLinkedList<Type> &>(lhs) ==
+         static_cast<const pmr::SingleLinkedList<Type> &>(rhs);
+}
+
+template <typename Type>
+bool operator!=(const ArenaSingleLinkedList<Type> &lhs,
+                const ArenaSingleLinkedList<Type> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type>
+detail::ThreeWayResult CompareThreeWay(const ArenaSingleLinkedList<Type> &lhs,
+                                       const ArenaSingleLinkedList<Type> &rhs) {
+  return CompareThreeWay(static_cast<const pmr::SingleLinkedList<Type> &>(lhs),
+                         static_cast<const pmr::SingleLinkedList<Type> &>(rhs));
+}
+
+template <typename Type>
+bool operator<(const ArenaSingleLinkedList<Type> &lhs,
+               const ArenaSingleLinkedList<Type> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type>
+bool operator<=(const ArenaSingleLinkedList<Type> &lhs,
+                const ArenaSingleLinkedList<Type> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type>
+bool operator>(const ArenaSingleLinkedList<Type> &lhs,
+               const ArenaSingleLinkedList<Type> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type>
+bool operator>=(const ArenaSingleLinkedList<Type> &lhs,
+                const ArenaSingleLinkedList<Type> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}
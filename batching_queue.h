@@ -0,0 +1,188 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "single_linked_list.h"
+
+/*
+ * Очередь между потоками, передающая элементы пакетами
+ * Производитель накапливает элементы в собственном списке Producer без
+ * синхронизации и переносит его в общую очередь целиком, за время O(1) и
+ * одним захватом мьютекса на пакет. Потребитель так же за один захват
+ * забирает все накопленные элементы. Порядок элементов одного производителя
+ * сохраняется
+ * Элемент становится доступен потребителю, когда пакет заполнится или
+ * производитель вызовет Flush, поэтому размер пакета ограничивает и число
+ * захватов мьютекса, и задержку доставки
+ * Аллокатор очереди используется всеми списками производителей, поскольку
+ * при переносе узлов аллокаторы списков должны быть равны
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class BatchingQueue {
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using List = SingleLinkedList<Type, Allocator>;
+
+  static constexpr size_t kDefaultBatchSize = 64;
+
+  /*
+   * Список, в котором один поток накапливает элементы для очереди
+   * Объект не синхронизирован и должен использоваться одним потоком за раз
+   * Деструктор передаёт в очередь оставшиеся элементы. Очередь должна
+   * существовать, пока существуют её производители
+   */
+  class Producer {
+   public:
+    Producer(Producer &&other) noexcept
+        : queue_(other.queue_),
+          batch_(std::move(other.batch_)),
+          batch_size_(other.batch_size_) {}
+
+    Producer &operator=(Producer &&rhs) noexcept {
+      if (this != &rhs) {
+        Flush();
+        queue_ = rhs.queue_;
+        batch_ = std::move(rhs.batch_);
+        batch_size_ = rhs.batch_size_;
+      }
+      return *this;
+    }
+
+    ~Producer() { Flush(); }
+
+    void Push(const Type &value) { Emplace(value); }
+    void Push(Type &&value) { Emplace(std::move(value)); }
+
+    // Добавляет элемент в пакет и передаёт пакет в очередь, когда в нём
+    // наберётся batch_size элементов
+    template <typename... Args>
+    void Emplace(Args &&...args) {
+      batch_.EmplaceBack(std::forward<Args>(args)...);
+      if (batch_.GetSize() >= batch_size_) {
+        Flush();
+      }
+    }
+
+    // Передаёт накопленные элементы в очередь
+    void Flush() {
+      if (!batch_.IsEmpty()) {
+        queue_->PushBatch(batch_);
+      }
+    }
+
+    // Возвращает количество элементов, ещё не переданных в очередь
+    [[nodiscard]] size_t GetPendingSize() const noexcept {
+      return batch_.GetSize();
+    }
+
+   private:
+    friend class BatchingQueue;
+
+    Producer(BatchingQueue *queue, size_t batch_size)
+        : queue_(queue), batch_(queue->alloc_), batch_size_(batch_size) {}
+
+    BatchingQueue *queue_;
+    List batch_;
+    size_t batch_size_;
+  };
+
+  BatchingQueue() : BatchingQueue(Allocator()) {}
+
+  explicit BatchingQueue(const Allocator &alloc)
+      : alloc_(alloc), queue_(alloc) {}
+
+  BatchingQueue(const BatchingQueue &) = delete;
+  BatchingQueue &operator=(const BatchingQueue &) = delete;
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return alloc_;
+  }
+
+  // Создаёт производителя, передающего элементы пакетами по batch_size
+  // При batch_size, равном 0 или 1, каждый элемент передаётся сразу
+  [[nodiscard]] Producer MakeProducer(size_t batch_size = kDefaultBatchSize) {
+    return Producer(this, batch_size);
+  }
+
+  // Добавляет в очередь один элемент, захватывая мьютекс
+  void Push(const Type &value) { Emplace(value); }
+  void Push(Type &&value) { Emplace(std::move(value)); }
+
+  template <typename... Args>
+  void Emplace(Args &&...args) {
+    {
+      std::lock_guard guard(mutex_);
+      queue_.EmplaceBack(std::forward<Args>(args)...);
+    }
+    ready_.notify_one();
+  }
+
+  // Переносит все элементы batch в конец очереди за время O(1). Аллокатор
+  // batch должен быть равен аллокатору очереди
+  void PushBatch(List &batch) {
+    {
+      std::lock_guard guard(mutex_);
+      queue_.SpliceBack(batch);
+    }
+    ready_.notify_one();
+  }
+
+  // Забирает все элементы очереди за время O(1). Если очередь пуста,
+  // возвращает пустой список, не дожидаясь элементов
+  [[nodiscard]] List TakeAll() {
+    List result(alloc_);
+    TakeAll(result);
+    return result;
+  }
+
+  // Переносит все элементы очереди в конец списка batch за время O(1)
+  // Позволяет потребителю повторно использовать один и тот же список
+  void TakeAll(List &batch) {
+    std::lock_guard guard(mutex_);
+    batch.SpliceBack(queue_);
+  }
+
+  // Дожидается элементов или закрытия очереди и забирает все элементы
+  // Пустой список означает, что очередь закрыта и все элементы забраны
+  [[nodiscard]] List WaitAndTakeAll() {
+    List result(alloc_);
+    std::unique_lock lock(mutex_);
+    ready_.wait(lock, [this] { return !queue_.IsEmpty() || closed_; });
+    result.SpliceBack(queue_);
+    return result;
+  }
+
+  // Закрывает очередь: WaitAndTakeAll больше не ждёт новых элементов
+  // Элементы, переданные до и после закрытия, по-прежнему можно забрать
+  void Close() {
+    {
+      std::lock_guard guard(mutex_);
+      closed_ = true;
+    }
+    ready_.notify_all();
+  }
+
+  [[nodiscard]] bool IsClosed() const {
+    std::lock_guard guard(mutex_);
+    return closed_;
+  }
+
+  // Возвращает количество элементов в очереди, не считая элементов,
+  // накопленных производителями
+  [[nodiscard]] size_t GetSize() const {
+    std::lock_guard guard(mutex_);
+    return queue_.GetSize();
+  }
+
+ private:
+  Allocator alloc_;
+  mutable std::mutex mutex_;
+  std::condition_variable ready_;
+  List queue_;
+  bool closed_ = false;
+};
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Сравнивает результаты compare_benchmark с сохранённой базовой линией.
+
+Результаты читаются из JSON Google Benchmark (--benchmark_out_format=json).
+Из повторений замера берётся лучшее: помехи от других процессов только
+замедляют замер, поэтому лучшее повторение устойчивее медианы
+Проверяется отношение пропускной способности SingleLinkedList к
+стандартному контейнеру в том же сценарии и том же запуске: общая скорость
+машины меняется от запуска к запуску, а отношение отражает изменения самого
+списка. С --absolute проверяется и пропускная способность каждого бенчмарка
+Скрипт завершается с кодом 1, если проверяемая величина упала относительно
+базовой линии больше чем на порог или пропала из результатов. С --update
+результаты записываются как новая базовая линия.
+"""
+
+import argparse
+import json
+import sys
+
+# Контейнеры, с которыми сравнивается SingleLinkedList в тех же сценариях
+LIST = "SingleLinkedList<int>"
+RIVALS = ("std::forward_list<int>", "std::deque<int>", "std::vector<int>")
+
+
+def load_throughput(path):
+    """Возвращает словарь имя бенчмарка -> элементов в секунду."""
+    with open(path, encoding="utf-8") as results_file:
+        results = json.load(results_file)
+    throughput = {}
+    for run in results["benchmarks"]:
+        if run.get("run_type") == "aggregate" or \
+                "items_per_second" not in run:
+            continue
+        name = run.get("run_name", run["name"])
+        throughput[name] = max(throughput.get(name, 0.0),
+                               run["items_per_second"])
+    return throughput
+
+
+def rival_ratios(throughput):
+    """Возвращает словарь "бенчмарк / контейнер" -> отношение пропускной
+    способности SingleLinkedList к стандартному контейнеру."""
+    ratios = {}
+    for name, value in throughput.items():
+        if LIST not in name:
+            continue
+        for rival in RIVALS:
+            rival_value = throughput.get(name.replace(LIST, rival))
+            if rival_value:
+                ratios[f"{name} / {rival}"] = value / rival_value
+    return ratios
+
+
+def compare(label, current, baseline, threshold, failures):
+    """Печатает изменение величин относительно базовой линии и добавляет в
+    failures упавшие больше чем на threshold."""
+    for name, expected in sorted(baseline.items()):
+        actual = current.get(name)
+        if actual is None:
+            failures.append(f"{name}: missing from results")
+            continue
+        change = actual / expected - 1.0
+        print(f"{label} {name}: {actual:.3g} ({change:+.1%})")
+        if change < -threshold:
+            failures.append(f"{name}: {label} {change:+.1%} below baseline "
+                            f"(threshold -{threshold:.0%})")
+    for name in sorted(current.keys() - baseline.keys()):
+        print(f"{label} {name}: not in baseline")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("results", help="JSON output of compare_benchmark")
+    parser.add_argument("baseline", help="stored baseline JSON")
+    parser.add_argument("--threshold", type=float, default=0.35,
+                        help="allowed relative throughput drop")
+    parser.add_argument("--absolute", action="store_true",
+                        help="also check the throughput of each benchmark")
+    parser.add_argument("--update", action="store_true",
+                        help="store the results as the new baseline")
+    args = parser.parse_args()
+
+    current = load_throughput(args.results)
+    if not current:
+        print(f"{args.results}: no benchmark results", file=sys.stderr)
+        return 1
+
+    if args.update:
+        with open(args.baseline, "w", encoding="utf-8") as baseline_file:
+            json.dump({"items_per_second": current}, baseline_file,
+                      indent=2, sort_keys=True)
+            baseline_file.write("\n")
+        for name, ratio in sorted(rival_ratios(current).items()):
+            print(f"ratio {name}: {ratio:.3g}")
+        print(f"Baseline {args.baseline} updated")
+        return 0
+
+    with open(args.baseline, encoding="utf-8") as baseline_file:
+        baseline = json.load(baseline_file)["items_per_second"]
+
+    failures = []
+    compare("ratio", rival_ratios(current), rival_ratios(baseline),
+            args.threshold, failures)
+    if args.absolute:
+        compare("items/s", current, baseline, args.threshold, failures)
+
+    if failures:
+        print("Benchmark regressions:", file=sys.stderr)
+        for failure in failures:
+            print(f"  {failure}", file=sys.stderr)
+        return 1
+    print(f"No regressions past {args.threshold:.0%}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
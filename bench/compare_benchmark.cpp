@@ -0,0 +1,225 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <numeric>
+#include <vector>
+
+#include "single_linked_list.h"
+
+/*
+ * Сравнение SingleLinkedList со стандартными контейнерами в одинаковых
+ * сценариях: с std::forward_list в операциях односвязного списка и с
+ * std::deque и std::vector в работе очереди
+ * Вывод в JSON (--benchmark_out_format=json) проверяет на регрессию
+ * bench/check_benchmark_regression.py, цель CMake benchmark_gate
+ */
+
+namespace {
+
+// Операции односвязных списков под общими именами, чтобы сценарии
+// выполняли для обоих контейнеров один и тот же код
+template <typename Type>
+void PushFront(SingleLinkedList<Type> &list, const Type &value) {
+  list.PushFront(value);
+}
+
+template <typename Type>
+void PushFront(std::forward_list<Type> &list, const Type &value) {
+  list.push_front(value);
+}
+
+template <typename Type, typename Iterator>
+Iterator InsertAfter(SingleLinkedList<Type> &list, Iterator pos,
+                     const Type &value) {
+  return list.InsertAfter(pos, value);
+}
+
+template <typename Type, typename Iterator>
+Iterator InsertAfter(std::forward_list<Type> &list, Iterator pos,
+                     const Type &value) {
+  return list.insert_after(pos, value);
+}
+
+template <typename Type, typename Iterator>
+void EraseAfter(SingleLinkedList<Type> &list, Iterator pos) {
+  list.EraseAfter(pos);
+}
+
+template <typename Type, typename Iterator>
+void EraseAfter(std::forward_list<Type> &list, Iterator pos) {
+  list.erase_after(pos);
+}
+
+template <typename Type>
+void Clear(SingleLinkedList<Type> &list) {
+  list.Clear();
+}
+
+template <typename Type>
+void Clear(std::forward_list<Type> &list) {
+  list.clear();
+}
+
+template <typename List>
+List MakeList(int64_t size) {
+  std::vector<typename List::value_type> values(static_cast<size_t>(size));
+  std::iota(values.begin(), values.end(), 0);
+  return List(values.begin(), values.end());
+}
+
+// Серия вставок в начало пустого списка. Замеры с PauseTiming на каждой
+// итерации заметно шумнее, поэтому в замер входит и очистка списка
+template <typename List>
+void BM_PushFrontBurst(benchmark::State &state) {
+  List list;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      PushFront(list, static_cast<typename List::value_type>(i));
+    }
+    benchmark::DoNotOptimize(list.begin());
+    Clear(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Копирование вместе с разрушением копии
+template <typename List>
+void BM_Copy(benchmark::State &state) {
+  const auto source = MakeList<List>(state.range(0));
+  for (auto _ : state) {
+    List copy(source);
+    benchmark::DoNotOptimize(copy.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Присваивание списку той же длины: оба контейнера переиспользуют узлы
+template <typename List>
+void BM_Assign(benchmark::State &state) {
+  const auto source = MakeList<List>(state.range(0));
+  auto receiver = MakeList<List>(state.range(0));
+  for (auto _ : state) {
+    receiver = source;
+    benchmark::DoNotOptimize(receiver.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void BM_Compare(benchmark::State &state) {
+  const auto lhs = MakeList<List>(state.range(0));
+  const auto rhs = MakeList<List>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Каждый элемент удаляется и заменяется новым на том же месте
+template <typename List>
+void BM_EraseAfterChurn(benchmark::State &state) {
+  auto list = MakeList<List>(state.range(0));
+  for (auto _ : state) {
+    auto pos = list.before_begin();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      EraseAfter(list, pos);
+      pos = InsertAfter(list, pos, static_cast<typename List::value_type>(i));
+    }
+    benchmark::DoNotOptimize(list.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename List>
+void BM_Clear(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = MakeList<List>(state.range(0));
+    state.ResumeTiming();
+    Clear(list);
+    benchmark::DoNotOptimize(list.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Очередь: пакет элементов добавляется в конец и забирается из начала
+void PushBack(SingleLinkedList<int> &queue, int value) {
+  queue.PushBack(value);
+}
+
+void PushBack(std::deque<int> &queue, int value) { queue.push_back(value); }
+
+void PushBack(std::vector<int> &queue, int value) { queue.push_back(value); }
+
+int TakeAll(SingleLinkedList<int> &queue) {
+  int sum = 0;
+  while (!queue.IsEmpty()) {
+    sum += *queue.begin();
+    queue.PopFront();
+  }
+  return sum;
+}
+
+int TakeAll(std::deque<int> &queue) {
+  int sum = 0;
+  while (!queue.empty()) {
+    sum += queue.front();
+    queue.pop_front();
+  }
+  return sum;
+}
+
+// Вектор в роли очереди читается по порядку и очищается целиком, так как
+// удаление из начала заняло бы линейное время на каждый элемент
+int TakeAll(std::vector<int> &queue) {
+  int sum = 0;
+  for (int value : queue) {
+    sum += value;
+  }
+  queue.clear();
+  return sum;
+}
+
+template <typename Queue>
+void BM_QueueFillDrain(benchmark::State &state) {
+  Queue queue;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      PushBack(queue, static_cast<int>(i));
+    }
+    benchmark::DoNotOptimize(TakeAll(queue));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define LIST_COMPARE_BENCHMARK(name)                            \
+  BENCHMARK_TEMPLATE(name, SingleLinkedList<int>)               \
+      ->RangeMultiplier(16)                                     \
+      ->Range(1 << 8, 1 << 16);                                 \
+  BENCHMARK_TEMPLATE(name, std::forward_list<int>)              \
+      ->RangeMultiplier(16)                                     \
+      ->Range(1 << 8, 1 << 16)
+
+LIST_COMPARE_BENCHMARK(BM_PushFrontBurst);
+LIST_COMPARE_BENCHMARK(BM_Copy);
+LIST_COMPARE_BENCHMARK(BM_Assign);
+LIST_COMPARE_BENCHMARK(BM_Compare);
+LIST_COMPARE_BENCHMARK(BM_EraseAfterChurn);
+LIST_COMPARE_BENCHMARK(BM_Clear);
+
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, SingleLinkedList<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, std::deque<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 16);
+BENCHMARK_TEMPLATE(BM_QueueFillDrain, std::vector<int>)
+    ->RangeMultiplier(16)
+    ->Range(1 << 8, 1 << 16);
+
+}  // namespace
+
+BENCHMARK_MAIN();
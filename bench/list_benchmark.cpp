@@ -0,0 +1,955 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arena_single_linked_list.h"
+#include "batching_queue.h"
+#include "concurrent_single_linked_list.h"
+#include "fingerprinted_single_linked_list.h"
+#include "indexed_single_linked_list.h"
+#include "list_reclaimer.h"
+#include "list_serialization.h"
+#include "mapped_single_linked_list.h"
+#include "parallel_algorithms.h"
+#include "persistent_single_linked_list.h"
+#include "positional_single_linked_list.h"
+#include "single_linked_list.h"
+#include "small_single_linked_list.h"
+#include "static_single_linked_list.h"
+#include "unrolled_single_linked_list.h"
+
+namespace {
+
+// Количество обращений к глобальному operator new с начала работы программы
+std::atomic<int64_t> allocation_count{0};
+
+// Тяжёлый элемент: копирование и сравнение затрагивают много памяти
+struct Heavy {
+  std::array<int64_t, 16> payload{};
+  std::string name;
+
+  bool operator==(const Heavy &rhs) const {
+    return payload == rhs.payload && name == rhs.name;
+  }
+  bool operator!=(const Heavy &rhs) const { return !(*this == rhs); }
+  bool operator<(const Heavy &rhs) const { return payload < rhs.payload; }
+};
+
+template <typename Type>
+Type MakeValue(int64_t i);
+
+template <>
+int MakeValue<int>(int64_t i) {
+  return static_cast<int>(i);
+}
+
+template <>
+float MakeValue<float>(int64_t i) {
+  return static_cast<float>(i);
+}
+
+template <>
+double MakeValue<double>(int64_t i) {
+  return static_cast<double>(i);
+}
+
+template <>
+std::string MakeValue<std::string>(int64_t i) {
+  // Строки длиннее буфера малой строки, чтобы каждая требовала выделения
+  return "benchmark value number " + std::to_string(i);
+}
+
+template <>
+Heavy MakeValue<Heavy>(int64_t i) {
+  Heavy value;
+  value.payload.fill(i);
+  value.name = MakeValue<std::string>(i);
+  return value;
+}
+
+template <typename Type>
+SingleLinkedList<Type> MakeList(int64_t size) {
+  SingleLinkedList<Type> list;
+  for (int64_t i = 0; i < size; ++i) {
+    list.PushBack(MakeValue<Type>(i));
+  }
+  return list;
+}
+
+template <typename Type>
+UnrolledSingleLinkedList<Type> MakeUnrolledList(int64_t size) {
+  UnrolledSingleLinkedList<Type> list;
+  for (int64_t i = 0; i < size; ++i) {
+    list.PushBack(MakeValue<Type>(i));
+  }
+  return list;
+}
+
+// Добавляет счётчики времени и количества выделений памяти в пересчёте на
+// один элемент списка
+void ReportPerElement(benchmark::State &state, int64_t allocations_before) {
+  const int64_t size = state.range(0);
+  const auto allocations = static_cast<double>(
+      allocation_count.load(std::memory_order_relaxed) - allocations_before);
+  state.SetItemsProcessed(state.iterations() * size);
+  state.counters["time/elem"] = benchmark::Counter(
+      static_cast<double>(size),
+      benchmark::Counter::kIsIterationInvariantRate |
+          benchmark::Counter::kInvert);
+  state.counters["allocs/elem"] = benchmark::Counter(
+      allocations / static_cast<double>(size),
+      benchmark::Counter::kAvgIterations);
+}
+
+template <typename Type>
+void BM_PushFront(benchmark::State &state) {
+  const int64_t size = state.range(0);
+  const Type value = MakeValue<Type>(size);
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    SingleLinkedList<Type> list;
+    for (int64_t i = 0; i < size; ++i) {
+      list.PushFront(value);
+    }
+    benchmark::DoNotOptimize(list.GetSize());
+    state.PauseTiming();
+    list.Clear();
+    state.ResumeTiming();
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_PushBack(benchmark::State &state) {
+  const int64_t size = state.range(0);
+  const Type value = MakeValue<Type>(size);
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    SingleLinkedList<Type> list;
+    for (int64_t i = 0; i < size; ++i) {
+      list.PushBack(value);
+    }
+    benchmark::DoNotOptimize(list.GetSize());
+    state.PauseTiming();
+    list.Clear();
+    state.ResumeTiming();
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_CopyConstruct(benchmark::State &state) {
+  const auto source = MakeList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    SingleLinkedList<Type> copy(source);
+    benchmark::DoNotOptimize(copy.GetSize());
+    state.PauseTiming();
+    copy.Clear();
+    state.ResumeTiming();
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_CopyAssign(benchmark::State &state) {
+  const auto source = MakeList<Type>(state.range(0));
+  auto receiver = MakeList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    receiver = source;
+    benchmark::DoNotOptimize(receiver.GetSize());
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_Equal(benchmark::State &state) {
+  auto lhs = MakeList<Type>(state.range(0));
+  auto rhs = MakeList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_ParallelEqual(benchmark::State &state) {
+  auto lhs = MakeList<Type>(state.range(0));
+  auto rhs = MakeList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ParallelEqual(kParallel, lhs, rhs));
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_Compare(benchmark::State &state) {
+  auto lhs = MakeList<Type>(state.range(0));
+  auto rhs = MakeList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs >= rhs);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+// Обход неконстантного списка, на каждом шаге сравнивающий итератор с end()
+template <typename Type>
+void BM_IterateMutable(benchmark::State &state) {
+  auto list = MakeList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    size_t count = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      benchmark::DoNotOptimize(*it);
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_Clear(benchmark::State &state) {
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = MakeList<Type>(state.range(0));
+    state.ResumeTiming();
+    list.Clear();
+    benchmark::DoNotOptimize(list.GetSize());
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+// Очистка списка в арене. Для int выполняется за O(1), для остальных типов
+// разрушает элементы, но не освобождает узлы по одному
+template <typename Type>
+void BM_ArenaClear(benchmark::State &state) {
+  const int64_t size = state.range(0);
+  ArenaSingleLinkedList<Type> list;
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int64_t i = 0; i < size; ++i) {
+      list.PushFront(MakeValue<Type>(i));
+    }
+    state.ResumeTiming();
+    list.Clear();
+    benchmark::DoNotOptimize(list.GetSize());
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+// Список с узлами в непрерывном буфере: буфер выделяется O(log N) раз, а
+// копия элементов с тривиальным копированием выполняется одним memcpy
+template <typename Type>
+void BM_IndexedPushBack(benchmark::State &state) {
+  const int64_t size = state.range(0);
+  const Type value = MakeValue<Type>(size);
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    IndexedSingleLinkedList<Type> list;
+    for (int64_t i = 0; i < size; ++i) {
+      list.PushBack(value);
+    }
+    benchmark::DoNotOptimize(list.GetSize());
+    state.PauseTiming();
+    list.Clear();
+    state.ResumeTiming();
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_IndexedCopyConstruct(benchmark::State &state) {
+  IndexedSingleLinkedList<Type> source;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    source.PushBack(MakeValue<Type>(i));
+  }
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    IndexedSingleLinkedList<Type> copy(source);
+    benchmark::DoNotOptimize(copy.GetSize());
+    state.PauseTiming();
+    copy.Clear();
+    state.ResumeTiming();
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+// Снимок списка для читателя: копия разделяет узлы, а добавление в начало
+// копии не копирует разделяемые узлы
+template <typename Type>
+void BM_PersistentSnapshot(benchmark::State &state) {
+  PersistentSingleLinkedList<Type> source;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    source.PushFront(MakeValue<Type>(i));
+  }
+  const Type value = MakeValue<Type>(0);
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    PersistentSingleLinkedList<Type> snapshot(source);
+    snapshot.PushFront(value);
+    benchmark::DoNotOptimize(snapshot.GetSize());
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+// Сравнение списков, различающихся последним элементом: обычный список
+// проходится целиком, а отпечатки различаются за O(1)
+template <typename Type>
+void BM_NotEqualLast(benchmark::State &state) {
+  auto lhs = MakeList<Type>(state.range(0));
+  auto rhs = MakeList<Type>(state.range(0) - 1);
+  rhs.PushBack(MakeValue<Type>(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs != rhs);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_FingerprintedNotEqualLast(benchmark::State &state) {
+  FingerprintedSingleLinkedList<Type> lhs;
+  FingerprintedSingleLinkedList<Type> rhs;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    lhs.PushBack(MakeValue<Type>(i));
+    rhs.PushBack(MakeValue<Type>(i + 1 < state.range(0) ? i : 0));
+  }
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs != rhs);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+// Чтение окна из kWindowSize элементов, начинающегося в случайной позиции
+constexpr int64_t kWindowSize = 20;
+
+template <typename Type>
+void BM_WindowNext(benchmark::State &state) {
+  const auto list = MakeList<Type>(state.range(0));
+  const auto size = static_cast<size_t>(state.range(0));
+  size_t start = 0;
+  for (auto _ : state) {
+    start = (start * 7919 + 104729) % size;
+    auto it = std::next(list.begin(), start);
+    for (int64_t i = 0; i < kWindowSize && it != list.end(); ++i, ++it) {
+      benchmark::DoNotOptimize(*it);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Type>
+void BM_WindowAt(benchmark::State &state) {
+  PositionalSingleLinkedList<Type> list;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    list.PushBack(MakeValue<Type>(i));
+  }
+  const auto size = static_cast<size_t>(state.range(0));
+  size_t start = 0;
+  for (auto _ : state) {
+    start = (start * 7919 + 104729) % size;
+    const size_t end = std::min(start + kWindowSize, size);
+    for (size_t position = start; position < end; ++position) {
+      benchmark::DoNotOptimize(list.At(position));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Чтение сериализованного списка: узлы создаются для каждого элемента
+template <typename Type>
+void BM_Deserialize(benchmark::State &state) {
+  std::stringstream stream;
+  SerializeList(MakeList<Type>(state.range(0)), stream);
+  const std::string bytes = stream.str();
+  for (auto _ : state) {
+    std::istringstream input(bytes);
+    benchmark::DoNotOptimize(DeserializeList<Type>(input));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Текст с элементами списка длины size, разделёнными пробелами
+template <typename Type>
+std::string MakeListText(int64_t size) {
+  std::ostringstream output;
+  for (const Type &value : MakeList<Type>(size)) {
+    output << value << ' ';
+  }
+  return output.str();
+}
+
+// Разбор текста через промежуточный вектор
+template <typename Type>
+void BM_ParseThroughVector(benchmark::State &state) {
+  const std::string text = MakeListText<Type>(state.range(0));
+  for (auto _ : state) {
+    std::istringstream input(text);
+    const std::vector<Type> values{std::istream_iterator<Type>(input),
+                                   std::istream_iterator<Type>()};
+    benchmark::DoNotOptimize(SingleLinkedList<Type>(values.begin(),
+                                                    values.end()));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Разбор текста прямо в узлы списка
+template <typename Type>
+void BM_ParseStream(benchmark::State &state) {
+  const std::string text = MakeListText<Type>(state.range(0));
+  for (auto _ : state) {
+    std::istringstream input(text);
+    benchmark::DoNotOptimize(SingleLinkedList<Type>(input));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Открытие отображённого в память файла и обход его элементов без
+// создания узлов
+template <typename Type>
+void BM_MappedIterate(benchmark::State &state) {
+  char path[] = "/tmp/sll_benchmark_XXXXXX";
+  const int fd = mkstemp(path);
+  if (fd < 0) {
+    state.SkipWithError("Failed to create a temporary file");
+    return;
+  }
+  close(fd);
+  {
+    std::ofstream output(path, std::ios::binary);
+    SerializeList(MakeList<Type>(state.range(0)), output);
+  }
+  for (auto _ : state) {
+    MappedSingleLinkedList<Type> mapped(path);
+    for (const Type &value : mapped) {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  std::remove(path);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Создание и разрушение пустого списка. Фиктивный узел не содержит
+// значения, поэтому стоимость не зависит от типа элементов
+template <typename Type>
+void BM_EmptyList(benchmark::State &state) {
+  for (auto _ : state) {
+    SingleLinkedList<Type> list;
+    benchmark::DoNotOptimize(list);
+  }
+}
+
+// Построение и обход короткого списка: узлы в динамической памяти и внутри
+// объекта списка
+constexpr int kSmallListSize = 16;
+
+void BM_SmallListBuild(benchmark::State &state) {
+  for (auto _ : state) {
+    SingleLinkedList<int> list;
+    for (int i = 0; i < kSmallListSize; ++i) {
+      list.PushBack(i);
+    }
+    for (int value : list) {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSmallListSize);
+}
+
+void BM_SmallInlineListBuild(benchmark::State &state) {
+  for (auto _ : state) {
+    SmallSingleLinkedList<int, kSmallListSize> list;
+    for (int i = 0; i < kSmallListSize; ++i) {
+      list.PushBack(i);
+    }
+    for (int value : list) {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSmallListSize);
+}
+
+void BM_StaticListBuild(benchmark::State &state) {
+  for (auto _ : state) {
+    StaticSingleLinkedList<int, kSmallListSize> list;
+    for (int i = 0; i < kSmallListSize; ++i) {
+      list.PushBack(i);
+    }
+    for (int value : list) {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kSmallListSize);
+}
+
+// Список из size элементов по возрастанию, узлы которого разбросаны по
+// памяти в случайном порядке: элементы добавляются в перемешанном порядке,
+// а сортировка переставляет узлы, не перемещая их
+template <typename Type>
+SingleLinkedList<Type> MakeScatteredList(int64_t size) {
+  std::vector<int64_t> order(static_cast<size_t>(size));
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(size));
+  SingleLinkedList<Type> list;
+  for (int64_t i : order) {
+    list.PushBack(MakeValue<Type>(i));
+  }
+  list.Sort();
+  return list;
+}
+
+// Вытесняет узлы списков из кэшей всех уровней, записывая буфер, который
+// больше кэша последнего уровня
+void EvictCaches() {
+  constexpr size_t kEvictionBytes = 512 << 20;
+  static std::vector<char> buffer(kEvictionBytes);
+  for (size_t i = 0; i < buffer.size(); i += detail::kCacheLineBytes) {
+    ++buffer[i];
+  }
+  benchmark::ClobberMemory();
+}
+
+// Обходы холодных списков, узлы которых не находятся в кэше. Сравнение
+// list_benchmark и list_benchmark_prefetch показывает действие
+// упреждающей загрузки
+template <typename Type>
+void BM_ColdForEach(benchmark::State &state) {
+  const auto list = MakeScatteredList<Type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    EvictCaches();
+    state.ResumeTiming();
+    size_t visited = 0;
+    list.ForEach([&visited](const Type &value) {
+      benchmark::DoNotOptimize(value);
+      ++visited;
+    });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+void BM_ColdEqual(benchmark::State &state) {
+  const auto lhs = MakeScatteredList<Type>(state.range(0));
+  const auto rhs = MakeScatteredList<Type>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    EvictCaches();
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+void BM_ColdCopy(benchmark::State &state) {
+  const auto source = MakeScatteredList<Type>(state.range(0));
+  std::optional<SingleLinkedList<Type>> copy;
+  for (auto _ : state) {
+    state.PauseTiming();
+    copy.reset();
+    EvictCaches();
+    state.ResumeTiming();
+    copy.emplace(source);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+void BM_ColdClear(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = MakeScatteredList<Type>(state.range(0));
+    EvictCaches();
+    state.ResumeTiming();
+    list.Clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Обход разбросанного списка после Compact. Счётчики near_before и
+// near_after — доли близких переходов до и после переноса узлов
+template <typename Type>
+void BM_ColdForEachCompacted(benchmark::State &state) {
+  auto list = MakeScatteredList<Type>(state.range(0));
+  const ListLocality before = list.MeasureLocality();
+  list.Compact();
+  const ListLocality after = list.MeasureLocality();
+  for (auto _ : state) {
+    state.PauseTiming();
+    EvictCaches();
+    state.ResumeTiming();
+    size_t visited = 0;
+    std::as_const(list).ForEach([&visited](const Type &value) {
+      benchmark::DoNotOptimize(value);
+      ++visited;
+    });
+    benchmark::DoNotOptimize(visited);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["near_before"] = before.GetNearFraction();
+  state.counters["near_after"] = after.GetNearFraction();
+}
+
+// Стоимость переноса холодного разбросанного списка целиком и шагами по
+// kCompactStep узлов
+constexpr size_t kCompactStep = 4096;
+
+template <typename Type>
+void BM_ColdCompact(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = MakeScatteredList<Type>(state.range(0));
+    EvictCaches();
+    state.ResumeTiming();
+    list.Compact();
+    state.PauseTiming();
+    list.Clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+void BM_ColdCompactSteps(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = MakeScatteredList<Type>(state.range(0));
+    EvictCaches();
+    state.ResumeTiming();
+    for (auto pos = list.CompactAfter(list.cbefore_begin(), kCompactStep);
+         pos != list.end(); pos = list.CompactAfter(pos, kCompactStep)) {
+    }
+    list.ShrinkToFit();
+    state.PauseTiming();
+    list.Clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Сравнение и поиск в развёрнутом списке, узлы которого обрабатываются
+// векторными ядрами
+template <typename Type>
+void BM_UnrolledEqual(benchmark::State &state) {
+  auto lhs = MakeUnrolledList<Type>(state.range(0));
+  auto rhs = MakeUnrolledList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs == rhs);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_UnrolledCompare(benchmark::State &state) {
+  auto lhs = MakeUnrolledList<Type>(state.range(0));
+  auto rhs = MakeUnrolledList<Type>(state.range(0));
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs >= rhs);
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+template <typename Type>
+void BM_UnrolledCount(benchmark::State &state) {
+  auto list = MakeUnrolledList<Type>(state.range(0));
+  const Type value = MakeValue<Type>(1);
+  const int64_t allocations_before = allocation_count.load();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(list.Count(value));
+  }
+  ReportPerElement(state, allocations_before);
+}
+
+constexpr int64_t kMinSize = 10;
+constexpr int64_t kMaxSize = 10'000'000;
+// Элементы Heavy занимают около 200 байт, поэтому для них размер ограничен,
+// чтобы два списка поместились в память
+constexpr int64_t kMaxHeavySize = 1'000'000;
+
+#define LIST_BENCHMARK(name)                                            \
+  BENCHMARK_TEMPLATE(name, int)                                         \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond);                                  \
+  BENCHMARK_TEMPLATE(name, std::string)                                 \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond);                                  \
+  BENCHMARK_TEMPLATE(name, Heavy)                                       \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxHeavySize)                                  \
+      ->Unit(benchmark::kMicrosecond)
+
+LIST_BENCHMARK(BM_PushFront);
+LIST_BENCHMARK(BM_PushBack);
+LIST_BENCHMARK(BM_CopyConstruct);
+LIST_BENCHMARK(BM_CopyAssign);
+LIST_BENCHMARK(BM_Equal);
+
+#define ARITHMETIC_BENCHMARK(name)                                      \
+  BENCHMARK_TEMPLATE(name, int)                                         \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond);                                  \
+  BENCHMARK_TEMPLATE(name, float)                                       \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond);                                  \
+  BENCHMARK_TEMPLATE(name, double)                                      \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond)
+
+ARITHMETIC_BENCHMARK(BM_UnrolledEqual);
+ARITHMETIC_BENCHMARK(BM_UnrolledCompare);
+ARITHMETIC_BENCHMARK(BM_UnrolledCount);
+ARITHMETIC_BENCHMARK(BM_Deserialize);
+ARITHMETIC_BENCHMARK(BM_MappedIterate);
+ARITHMETIC_BENCHMARK(BM_ParseThroughVector);
+ARITHMETIC_BENCHMARK(BM_ParseStream);
+LIST_BENCHMARK(BM_ParallelEqual);
+LIST_BENCHMARK(BM_Compare);
+LIST_BENCHMARK(BM_IterateMutable);
+LIST_BENCHMARK(BM_Clear);
+LIST_BENCHMARK(BM_ArenaClear);
+LIST_BENCHMARK(BM_IndexedPushBack);
+LIST_BENCHMARK(BM_IndexedCopyConstruct);
+LIST_BENCHMARK(BM_PersistentSnapshot);
+
+// Для Heavy не определён std::hash, поэтому отпечатки сравниваются только для
+// int и std::string
+#define HASHABLE_BENCHMARK(name)                                        \
+  BENCHMARK_TEMPLATE(name, int)                                         \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond);                                  \
+  BENCHMARK_TEMPLATE(name, std::string)                                 \
+      ->RangeMultiplier(10)                                             \
+      ->Range(kMinSize, kMaxSize)                                       \
+      ->Unit(benchmark::kMicrosecond)
+
+HASHABLE_BENCHMARK(BM_NotEqualLast);
+HASHABLE_BENCHMARK(BM_FingerprintedNotEqualLast);
+
+// Холодные списки длиннее кэша второго уровня. Каждая итерация
+// предваряется вытеснением кэшей, поэтому итераций немного
+#define COLD_BENCHMARK(name)                                            \
+  BENCHMARK_TEMPLATE(name, int)                                         \
+      ->RangeMultiplier(4)                                              \
+      ->Range(1 << 20, 1 << 22)                                         \
+      ->Unit(benchmark::kMillisecond);                                  \
+  BENCHMARK_TEMPLATE(name, std::string)                                 \
+      ->Arg(1 << 20)                                                    \
+      ->Unit(benchmark::kMillisecond)
+
+COLD_BENCHMARK(BM_ColdForEach);
+COLD_BENCHMARK(BM_ColdEqual);
+COLD_BENCHMARK(BM_ColdCopy);
+COLD_BENCHMARK(BM_ColdClear);
+COLD_BENCHMARK(BM_ColdForEachCompacted);
+COLD_BENCHMARK(BM_ColdCompact);
+COLD_BENCHMARK(BM_ColdCompactSteps);
+
+// Время обхода до окна растёт с длиной списка, поэтому размеры ограничены
+BENCHMARK_TEMPLATE(BM_WindowNext, int)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_WindowAt, int)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1'000'000)
+    ->Unit(benchmark::kMicrosecond);
+
+// Количество операций PushFront и TryPopFront, выполняемых каждым потоком за
+// одну итерацию многопоточных бенчмарков
+constexpr int64_t kOperationsPerIteration = 64;
+
+// Общий список, в который все потоки добавляют и из которого извлекают
+// элементы. Каждая итерация возвращает список к исходному размеру
+ConcurrentSingleLinkedList<int> concurrent_list;
+
+void BM_ConcurrentPushPop(benchmark::State &state) {
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kOperationsPerIteration; ++i) {
+      concurrent_list.PushFront(static_cast<int>(i));
+    }
+    for (int64_t i = 0; i < kOperationsPerIteration; ++i) {
+      benchmark::DoNotOptimize(concurrent_list.TryPopFront());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kOperationsPerIteration * 2);
+}
+
+// Та же нагрузка на обычный список, защищённый внешним мьютексом
+std::mutex locked_list_mutex;
+SingleLinkedList<int> locked_list;
+
+void BM_MutexPushPop(benchmark::State &state) {
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kOperationsPerIteration; ++i) {
+      std::lock_guard guard(locked_list_mutex);
+      locked_list.PushFront(static_cast<int>(i));
+    }
+    for (int64_t i = 0; i < kOperationsPerIteration; ++i) {
+      std::lock_guard guard(locked_list_mutex);
+      if (!locked_list.IsEmpty()) {
+        benchmark::DoNotOptimize(*locked_list.begin());
+        locked_list.PopFront();
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kOperationsPerIteration * 2);
+}
+
+// Та же нагрузка на очередь с пакетной передачей: каждый поток накапливает
+// элементы в своём производителе и забирает их одним вызовом TakeAll
+BatchingQueue<int> batching_queue;
+
+void BM_BatchingPushTake(benchmark::State &state) {
+  auto producer =
+      batching_queue.MakeProducer(static_cast<size_t>(kOperationsPerIteration));
+  SingleLinkedList<int> batch;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kOperationsPerIteration; ++i) {
+      producer.Push(static_cast<int>(i));
+    }
+    batching_queue.TakeAll(batch);
+    for (int value : batch) {
+      benchmark::DoNotOptimize(value);
+    }
+    batch.Clear();
+  }
+  state.SetItemsProcessed(state.iterations() * kOperationsPerIteration * 2);
+}
+
+// Время, на которое освобождение списка задерживает вызывающий поток:
+// Clear обходит все узлы, ReleaseAsync передаёт их потоку освобождения
+// Освобождение в фоне завершается вне замера
+template <typename Type>
+void BM_ReleaseClear(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list = MakeList<Type>(state.range(0));
+    state.ResumeTiming();
+    list.Clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Type>
+void BM_ReleaseAsync(benchmark::State &state) {
+  ListReclaimer reclaimer;
+  for (auto _ : state) {
+    state.PauseTiming();
+    reclaimer.Drain();
+    auto list = MakeList<Type>(state.range(0));
+    state.ResumeTiming();
+    reclaimer.ReleaseAsync(list);
+  }
+  reclaimer.Drain();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+// Задержка доставки элемента от производителя до потребителя в другом потоке
+// в зависимости от размера пакета. Элемент хранит время своего создания
+void BM_BatchingLatency(benchmark::State &state) {
+  using Clock = std::chrono::steady_clock;
+  BatchingQueue<Clock::time_point> queue;
+  std::atomic<int64_t> total_latency{0};
+  std::atomic<int64_t> delivered{0};
+  std::thread consumer([&] {
+    for (auto batch = queue.WaitAndTakeAll(); !batch.IsEmpty();
+         batch = queue.WaitAndTakeAll()) {
+      const Clock::time_point now = Clock::now();
+      int64_t latency = 0;
+      for (const Clock::time_point &created : batch) {
+        latency += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       now - created)
+                       .count();
+      }
+      total_latency.fetch_add(latency, std::memory_order_relaxed);
+      delivered.fetch_add(static_cast<int64_t>(batch.GetSize()),
+                          std::memory_order_relaxed);
+    }
+  });
+  {
+    auto producer = queue.MakeProducer(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+      producer.Push(Clock::now());
+    }
+  }
+  queue.Close();
+  consumer.join();
+  state.SetItemsProcessed(state.iterations());
+  state.counters["latency_ns"] = benchmark::Counter(
+      static_cast<double>(total_latency.load()) /
+      static_cast<double>(std::max<int64_t>(delivered.load(), 1)));
+}
+
+constexpr int kMaxThreads = 64;
+
+BENCHMARK(BM_ConcurrentPushPop)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_MutexPushPop)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_BatchingPushTake)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK(BM_SmallListBuild);
+BENCHMARK(BM_SmallInlineListBuild);
+BENCHMARK(BM_StaticListBuild);
+BENCHMARK_TEMPLATE(BM_EmptyList, int);
+BENCHMARK_TEMPLATE(BM_EmptyList, Heavy);
+BENCHMARK(BM_BatchingLatency)->RangeMultiplier(16)->Range(1, 4096);
+BENCHMARK_TEMPLATE(BM_ReleaseClear, int)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ReleaseClear, std::string)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ReleaseAsync, int)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_ReleaseAsync, std::string)->Arg(1 << 20);
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+// Замещающий operator new выделяет память через malloc, поэтому освобождать
+// её через free корректно
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+#pragma GCC diagnostic pop
+
+BENCHMARK_MAIN();
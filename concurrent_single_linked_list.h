@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "hazard_pointer_domain.h"
+
+/*
+ * Неблокирующий односвязный список Трайбера для обмена элементами между
+ * потоками
+ * PushFront, EmplaceFront и TryPopFront можно вызывать из любого числа потоков
+ * одновременно без внешней синхронизации. Извлечённые узлы освобождаются через
+ * домен указателей опасности, поэтому поток, читающий узел, никогда не
+ * обратится к освобождённой памяти, а повторное использование адреса не
+ * приводит к проблеме ABA
+ * Аллокатор должен допускать одновременное использование из нескольких
+ * потоков: NodePoolResource такому требованию не удовлетворяет
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class ConcurrentSingleLinkedList {
+  struct Node : HazardPointerDomain::RetiredNode {
+    template <typename... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    Type value;
+    // Устанавливается до публикации узла и после этого не меняется, поэтому
+    // доступ к нему не требует атомарности
+    Node *next_node = nullptr;
+  };
+
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  static_assert(std::is_same_v<typename NodeTraits::pointer, Node *>,
+                "ConcurrentSingleLinkedList requires an allocator with raw "
+                "pointers");
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+
+  ConcurrentSingleLinkedList() : ConcurrentSingleLinkedList(Allocator()) {}
+
+  explicit ConcurrentSingleLinkedList(const Allocator &alloc)
+      : alloc_(alloc), domain_(&ReclaimNode, this) {}
+
+  ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList &) = delete;
+  ConcurrentSingleLinkedList &operator=(const ConcurrentSingleLinkedList &) =
+      delete;
+
+  // Деструктор не должен выполняться одновременно с другими операциями
+  ~ConcurrentSingleLinkedList() {
+    Node *node = head_.load(std::memory_order_acquire);
+    while (node != nullptr) {
+      DestroyNode(std::exchange(node, node->next_node));
+    }
+    // Узлы, ожидающие освобождения, используют аллокатор списка, поэтому
+    // домен освобождает их до разрушения alloc_
+    domain_.ReclaimAll();
+  }
+
+  [[nodiscard]] Allocator get_allocator() const noexcept {
+    return Allocator(alloc_);
+  }
+
+  /*
+   * Возвращает количество элементов в списке
+   * При одновременных изменениях значение является моментальным снимком:
+   * счётчик увеличивается до публикации элемента и уменьшается после его
+   * извлечения, поэтому он никогда не бывает меньше числа элементов, которые
+   * можно извлечь
+   */
+  [[nodiscard]] size_t GetSize() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool IsEmpty() const noexcept {
+    return head_.load(std::memory_order_acquire) == nullptr;
+  }
+
+  void PushFront(const Type &value) { EmplaceFront(value); }
+
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  // Конструирует элемент в новом узле и атомарно делает его первым
+  template <typename... Args>
+  void EmplaceFront(Args &&...args) {
+    Node *node = CreateNode(std::forward<Args>(args)...);
+    size_.fetch_add(1, std::memory_order_relaxed);
+    node->next_node = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(node->next_node, node,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+  }
+
+  /*
+   * Извлекает первый элемент списка. Возвращает пустое значение, если список
+   * пуст
+   * Если перемещение элемента из узла выбросит исключение, элемент будет
+   * потерян, поэтому Type должен иметь перемещающий конструктор без исключений
+   */
+  std::optional<Type> TryPopFront() {
+    static_assert(std::is_nothrow_move_constructible_v<Type>,
+                  "TryPopFront requires a nothrow move constructible Type");
+    HazardPointerDomain::Guard guard(domain_);
+    Node *node = guard.Protect(head_);
+    while (node != nullptr) {
+      // Пока узел защищён, он не может быть освобождён, а значит, и
+      // переиспользован под другой узел с тем же адресом
+      Node *next = node->next_node;
+      if (head_.compare_exchange_weak(node, next, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
+      node = guard.Protect(head_);
+    }
+    if (node == nullptr) {
+      return std::nullopt;
+    }
+    guard.Reset();
+    size_.fetch_sub(1, std::memory_order_relaxed);
+
+    std::optional<Type> result(std::move(node->value));
+    guard.Retire(node);
+    return result;
+  }
+
+ private:
+  template <typename... Args>
+  Node *CreateNode(Args &&...args) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+    try {
+      NodeTraits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void DestroyNode(Node *node) noexcept {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+
+  static void ReclaimNode(void *context,
+                          HazardPointerDomain::RetiredNode *node) noexcept {
+    static_cast<ConcurrentSingleLinkedList *>(context)->DestroyNode(
+        static_cast<Node *>(node));
+  }
+
+  NodeAllocator alloc_;
+  std::atomic<Node *> head_{nullptr};
+  std::atomic<size_t> size_{0};
+  HazardPointerDomain domain_;
+};
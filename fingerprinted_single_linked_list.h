@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "list_hash.h"
+#include "single_linked_list.h"
+
+/*
+ * Односвязный список, поддерживающий отпечаток своего содержимого
+ * Отпечаток — сумма перемешанных хешей элементов. Он не зависит от порядка
+ * элементов и обновляется за O(1) при каждой вставке и удалении, поэтому
+ * списки с разными отпечатками заведомо не равны: operator== и operator!=
+ * для них выполняются за O(1), а полное сравнение нужно только при
+ * совпадении отпечатков. Отпечаток также служит хешем для std::hash, что
+ * позволяет за O(1) хешировать списки — ключи std::unordered_map
+ * Элементы доступны только для чтения, так как изменение элемента через
+ * итератор не обновило бы отпечаток. Для операций, которых нет в этом
+ * классе, служит GetList
+ * Равные элементы должны иметь равные хеши std::hash<Type>
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class FingerprintedSingleLinkedList {
+  using List = SingleLinkedList<Type, Allocator>;
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using ConstIterator = typename List::ConstIterator;
+  using Iterator = ConstIterator;
+
+  FingerprintedSingleLinkedList() = default;
+
+  explicit FingerprintedSingleLinkedList(const Allocator &alloc)
+      : list_(alloc) {}
+
+  FingerprintedSingleLinkedList(std::initializer_list<Type> values,
+                                const Allocator &alloc = Allocator())
+      : list_(values, alloc) {
+    for (const Type &value : list_) {
+      fingerprint_ += ElementFingerprint(value);
+    }
+  }
+
+  FingerprintedSingleLinkedList(const FingerprintedSingleLinkedList &) =
+      default;
+  FingerprintedSingleLinkedList &operator=(
+      const FingerprintedSingleLinkedList &) = default;
+
+  FingerprintedSingleLinkedList(FingerprintedSingleLinkedList &&other) noexcept
+      : list_(std::move(other.list_)),
+        fingerprint_(std::exchange(other.fingerprint_, 0)) {}
+
+  FingerprintedSingleLinkedList &operator=(
+      FingerprintedSingleLinkedList &&rhs) noexcept {
+    if (this != &rhs) {
+      list_ = std::move(rhs.list_);
+      fingerprint_ = std::exchange(rhs.fingerprint_, 0);
+    }
+    return *this;
+  }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return list_.get_allocator();
+  }
+
+  [[nodiscard]] const List &GetList() const noexcept { return list_; }
+
+  // Возвращает отпечаток содержимого. Равные списки имеют равные отпечатки
+  [[nodiscard]] uint64_t GetFingerprint() const noexcept {
+    return fingerprint_;
+  }
+
+  [[nodiscard]] size_t GetSize() const noexcept { return list_.GetSize(); }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return list_.IsEmpty(); }
+
+  [[nodiscard]] ConstIterator begin() const noexcept { return list_.begin(); }
+  [[nodiscard]] ConstIterator end() const noexcept { return list_.end(); }
+  [[nodiscard]] ConstIterator cbegin() const noexcept { return begin(); }
+  [[nodiscard]] ConstIterator cend() const noexcept { return end(); }
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return list_.before_begin();
+  }
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return before_begin();
+  }
+
+  void PushFront(const Type &value) { EmplaceFront(value); }
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  template <typename... Args>
+  const Type &EmplaceFront(Args &&...args) {
+    return Track(list_.EmplaceFront(std::forward<Args>(args)...));
+  }
+
+  void PushBack(const Type &value) { EmplaceBack(value); }
+  void PushBack(Type &&value) { EmplaceBack(std::move(value)); }
+
+  template <typename... Args>
+  const Type &EmplaceBack(Args &&...args) {
+    return Track(list_.EmplaceBack(std::forward<Args>(args)...));
+  }
+
+  ConstIterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  ConstIterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  ConstIterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    auto it = list_.EmplaceAfter(pos, std::forward<Args>(args)...);
+    Track(*it);
+    return it;
+  }
+
+  void PopFront() noexcept {
+    Untrack(*list_.begin());
+    list_.PopFront();
+  }
+
+  ConstIterator EraseAfter(ConstIterator pos) noexcept {
+    Untrack(*std::next(pos));
+    return list_.EraseAfter(pos);
+  }
+
+  // Удаляет элементы, для которых pred возвращает true, и возвращает их
+  // количество
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred) {
+    return list_.RemoveIf([this, &pred](const Type &value) {
+      if (!pred(value)) {
+        return false;
+      }
+      Untrack(value);
+      return true;
+    });
+  }
+
+  size_t Remove(const Type &value) {
+    return RemoveIf([&value](const Type &item) { return item == value; });
+  }
+
+  void Clear() noexcept {
+    list_.Clear();
+    fingerprint_ = 0;
+  }
+
+  // Перестановка элементов не изменяет отпечаток
+  template <typename Compare>
+  void Sort(Compare comp) {
+    list_.Sort(comp);
+  }
+
+  void Sort() { list_.Sort(); }
+
+  void swap(FingerprintedSingleLinkedList &other) noexcept {
+    list_.swap(other.list_);
+    std::swap(fingerprint_, other.fingerprint_);
+  }
+
+ private:
+  // Смещение исключает нулевой вклад элементов с нулевым хешем, так как
+  // MixHash(0) == 0
+  static uint64_t ElementFingerprint(const Type &value) noexcept {
+    return detail::MixHash(std::hash<Type>()(value) + 0x9e3779b97f4a7c15ull);
+  }
+
+  const Type &Track(const Type &value) noexcept {
+    fingerprint_ += ElementFingerprint(value);
+    return value;
+  }
+
+  void Untrack(const Type &value) noexcept {
+    fingerprint_ -= ElementFingerprint(value);
+  }
+
+  List list_;
+  uint64_t fingerprint_ = 0;
+};
+
+template <typename Type, typename Allocator>
+void swap(FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+          FingerprintedSingleLinkedList<Type, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+// Списки с разными отпечатками или длинами различаются за O(1)
+template <typename Type, typename Allocator>
+bool operator==(const FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+                const FingerprintedSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetFingerprint() == rhs.GetFingerprint() &&
+         lhs.GetList() == rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator!=(const FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+                const FingerprintedSingleLinkedList<Type, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator<(const FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+               const FingerprintedSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() < rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator<=(const FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+                const FingerprintedSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() <= rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator>(const FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+               const FingerprintedSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() > rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator>=(const FingerprintedSingleLinkedList<Type, Allocator> &lhs,
+                const FingerprintedSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() >= rhs.GetList();
+}
+
+namespace std {
+// Хешем служит отпечаток, поэтому хеширование выполняется за O(1)
+template <typename Type, typename Allocator>
+struct hash<FingerprintedSingleLinkedList<Type, Allocator>> {
+  size_t operator()(
+      const FingerprintedSingleLinkedList<Type, Allocator> &list) const {
+    return static_cast<size_t>(
+        detail::MixHash(list.GetFingerprint() ^ list.GetSize()));
+  }
+};
+}  // namespace std
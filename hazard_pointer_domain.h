@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/*
+ * Домен указателей опасности (hazard pointers) для безопасного освобождения
+ * памяти в неблокирующих структурах данных
+ * Поток, собирающийся разыменовать разделяемый указатель, публикует его в
+ * своей записи домена. Объект, исключённый из структуры, не освобождается
+ * сразу, а помещается в список ожидающих освобождения и уничтожается только
+ * тогда, когда ни одна запись его не публикует. Пока объект защищён, его адрес
+ * не может быть переиспользован, поэтому защищённые операции не подвержены
+ * проблеме ABA
+ * Операция, исключающая объект из структуры, должна выполняться с порядком
+ * memory_order_seq_cst, чтобы оказаться упорядоченной с публикацией указателя
+ * Объекты, передаваемые в Retire, должны быть унаследованы от RetiredNode,
+ * поэтому список ожидающих освобождения не требует выделения памяти
+ */
+class HazardPointerDomain {
+ public:
+  // Звено списка объектов, ожидающих освобождения
+  struct RetiredNode {
+    RetiredNode *next_retired = nullptr;
+    // Адрес объекта в том виде, в котором его публикует Protect
+    const void *address = nullptr;
+  };
+
+  // Функция, освобождающая объект. context передаётся из конструктора домена
+  using Reclaimer = void (*)(void *context, RetiredNode *node) noexcept;
+
+ private:
+  // Запись домена. Принадлежит не более чем одному потоку одновременно и
+  // переиспользуется после освобождения
+  struct Record {
+    std::atomic<const void *> hazard{nullptr};
+    std::atomic<bool> active{true};
+    Record *next = nullptr;
+    // Объекты, исключённые владельцем записи и ещё не освобождённые
+    RetiredNode *retired = nullptr;
+    size_t retired_count = 0;
+  };
+
+ public:
+  HazardPointerDomain(Reclaimer reclaimer, void *context) noexcept
+      : reclaimer_(reclaimer), context_(context) {}
+
+  HazardPointerDomain(const HazardPointerDomain &) = delete;
+  HazardPointerDomain &operator=(const HazardPointerDomain &) = delete;
+
+  ~HazardPointerDomain() {
+    ReclaimAll();
+    Record *record = records_.load(std::memory_order_relaxed);
+    while (record != nullptr) {
+      delete std::exchange(record, record->next);
+    }
+  }
+
+  /*
+   * Защита одного указателя на время операции
+   * Захватывает свободную запись домена в конструкторе и возвращает её в
+   * деструкторе. Объекты, исключённые через Retire и ещё не освобождённые,
+   * остаются в записи и будут освобождены её следующими владельцами
+   */
+  class Guard {
+   public:
+    explicit Guard(HazardPointerDomain &domain)
+        : domain_(domain), record_(domain.AcquireRecord()) {}
+
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+    ~Guard() {
+      record_->hazard.store(nullptr, std::memory_order_release);
+      record_->active.store(false, std::memory_order_release);
+    }
+
+    /*
+     * Читает указатель из source и публикует его, повторяя чтение, пока
+     * опубликованное значение не совпадёт с текущим. Возвращённый указатель
+     * можно разыменовывать до вызова Reset или следующего Protect
+     */
+    template <typename Pointer>
+    Pointer *Protect(const std::atomic<Pointer *> &source) noexcept {
+      Pointer *pointer = source.load(std::memory_order_relaxed);
+      while (true) {
+        record_->hazard.store(pointer, std::memory_order_seq_cst);
+        Pointer *current = source.load(std::memory_order_seq_cst);
+        if (current == pointer) {
+          return pointer;
+        }
+        pointer = current;
+      }
+    }
+
+    void Reset() noexcept {
+      record_->hazard.store(nullptr, std::memory_order_release);
+    }
+
+    /*
+     * Передаёт домену объект, уже исключённый из структуры данных. Объект
+     * будет освобождён, когда ни один поток не будет его защищать
+     */
+    template <typename Pointer>
+    void Retire(Pointer *pointer) noexcept {
+      RetiredNode *node = pointer;
+      node->address = pointer;
+      node->next_retired = record_->retired;
+      record_->retired = node;
+      ++record_->retired_count;
+      if (record_->retired_count >= domain_.GetScanThreshold()) {
+        domain_.Scan(*record_);
+      }
+    }
+
+   private:
+    HazardPointerDomain &domain_;
+    Record *record_;
+  };
+
+  /*
+   * Освобождает все ожидающие объекты независимо от их защиты
+   * Допустимо вызывать только тогда, когда домен не используется другими
+   * потоками
+   */
+  void ReclaimAll() noexcept {
+    for (Record *record = records_.load(std::memory_order_acquire);
+         record != nullptr; record = record->next) {
+      while (record->retired != nullptr) {
+        RetiredNode *node = record->retired;
+        record->retired = node->next_retired;
+        reclaimer_(context_, node);
+      }
+      record->retired_count = 0;
+    }
+  }
+
+  // Возвращает количество записей домена. Совпадает с наибольшим числом
+  // потоков, одновременно выполнявших защищённые операции
+  [[nodiscard]] size_t GetRecordCount() const noexcept {
+    return record_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Наименьшее количество ожидающих объектов, при котором запись
+  // просматривается. Порог растёт вместе с числом записей, поэтому
+  // амортизированная стоимость освобождения одного объекта постоянна
+  static constexpr size_t kMinScanThreshold = 64;
+
+  size_t GetScanThreshold() const noexcept {
+    return std::max(kMinScanThreshold, 2 * GetRecordCount());
+  }
+
+  Record *AcquireRecord() {
+    for (Record *record = records_.load(std::memory_order_acquire);
+         record != nullptr; record = record->next) {
+      if (!record->active.load(std::memory_order_relaxed) &&
+          !record->active.exchange(true, std::memory_order_acquire)) {
+        return record;
+      }
+    }
+
+    // Свободных записей нет: новая запись добавляется в начало списка и
+    // больше никогда из него не удаляется
+    auto *record = new Record();
+    Record *head = records_.load(std::memory_order_relaxed);
+    do {
+      record->next = head;
+    } while (!records_.compare_exchange_weak(head, record,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    record_count_.fetch_add(1, std::memory_order_relaxed);
+    return record;
+  }
+
+  // Возвращает true, если какая-либо запись домена публикует pointer
+  bool IsProtected(const void *pointer) const noexcept {
+    for (Record *record = records_.load(std::memory_order_acquire);
+         record != nullptr; record = record->next) {
+      if (record->hazard.load(std::memory_order_seq_cst) == pointer) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Освобождает незащищённые объекты из списка ожидающих записи record
+  void Scan(Record &record) noexcept {
+    RetiredNode *pending = std::exchange(record.retired, nullptr);
+    record.retired_count = 0;
+    while (pending != nullptr) {
+      RetiredNode *node = std::exchange(pending, pending->next_retired);
+      if (IsProtected(node->address)) {
+        node->next_retired = record.retired;
+        record.retired = node;
+        ++record.retired_count;
+      } else {
+        reclaimer_(context_, node);
+      }
+    }
+  }
+
+  Reclaimer reclaimer_;
+  void *context_;
+  std::atomic<Record *> records_{nullptr};
+  std::atomic<size_t> record_count_{0};
+};
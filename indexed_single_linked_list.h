@@ -0,0 +1,579 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "list_compare.h"
+
+/*
+ * Односвязный список, узлы которого хранятся в одном непрерывном буфере и
+ * ссылаются друг на друга 32-битными индексами вместо указателей
+ * Узел занимает sizeof(uint32_t) плюс размер элемента с выравниванием и не
+ * несёт накладных расходов отдельного выделения памяти. Удалённые узлы
+ * образуют список свободных и переиспользуются. При заполнении буфер
+ * увеличивается вдвое
+ * Узлы не содержат указателей, поэтому для типов с тривиальным копированием
+ * буфер переносится и копируется целиком через memcpy
+ * Итератор хранит указатель на список и индекс узла, поэтому увеличение
+ * буфера не делает итераторы недействительными. Ссылки и указатели на
+ * элементы при увеличении буфера становятся недействительными
+ * Список вмещает не более 2^32 - 2 элементов
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class IndexedSingleLinkedList {
+  using Index = uint32_t;
+
+  // Индекс, обозначающий отсутствие узла (end())
+  static constexpr Index kNull = std::numeric_limits<Index>::max();
+  // Индекс фиктивного узла перед первым элементом (before_begin())
+  static constexpr Index kHead = kNull - 1;
+
+  struct Slot {
+    Type *Value() noexcept {
+      return std::launder(reinterpret_cast<Type *>(storage));
+    }
+    const Type *Value() const noexcept {
+      return std::launder(reinterpret_cast<const Type *>(storage));
+    }
+
+    Index next;
+    alignas(Type) unsigned char storage[sizeof(Type)];
+  };
+
+  using SlotAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using SlotTraits = std::allocator_traits<SlotAllocator>;
+  static_assert(std::is_same_v<typename SlotTraits::pointer, Slot *>,
+                "Allocator must use raw pointers");
+
+  // Буфер копируется и переносится побайтно, только если это допустимо
+  // для элементов
+  static constexpr bool kIsBitwiseCopyable = std::is_trivially_copyable_v<Type>;
+
+  template <typename ValueType>
+  class BasicIterator {
+    friend class IndexedSingleLinkedList;
+    using ListPointer =
+        std::conditional_t<std::is_const_v<ValueType>,
+                           const IndexedSingleLinkedList *,
+                           IndexedSingleLinkedList *>;
+
+    BasicIterator(ListPointer list, Index index) noexcept
+        : list_(list), index_(index) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    // Конвертирующий конструктор/конструктор копирования
+    BasicIterator(const BasicIterator<Type> &other) noexcept
+        : list_(other.list_), index_(other.index_) {}
+
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    // Итераторы end() разных списков равны, как и в SingleLinkedList
+    [[nodiscard]] bool operator==(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return index_ == rhs.index_ && (index_ == kNull || list_ == rhs.list_);
+    }
+
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    [[nodiscard]] bool operator==(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return index_ == rhs.index_ && (index_ == kNull || list_ == rhs.list_);
+    }
+
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    BasicIterator &operator++() noexcept {
+      index_ = list_->NextOf(index_);
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator prev(*this);
+      ++(*this);
+      return prev;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+      return *list_->slots_[index_].Value();
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+      return list_->slots_[index_].Value();
+    }
+
+   private:
+    ListPointer list_ = nullptr;
+    Index index_ = kNull;
+  };
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using Iterator = BasicIterator<Type>;
+  using ConstIterator = BasicIterator<const Type>;
+
+  // Наибольшее количество элементов списка
+  static constexpr size_t kMaxSize = kHead;
+
+  IndexedSingleLinkedList() = default;
+
+  explicit IndexedSingleLinkedList(const Allocator &alloc) : alloc_(alloc) {}
+
+  IndexedSingleLinkedList(std::initializer_list<Type> values,
+                          const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    Reserve(values.size());
+    try {
+      for (const Type &value : values) {
+        PushBack(value);
+      }
+    } catch (...) {
+      Release();
+      throw;
+    }
+  }
+
+  // Копия сохраняет расположение узлов в буфере. Для типов с тривиальным
+  // копированием буфер копируется одним вызовом memcpy
+  IndexedSingleLinkedList(const IndexedSingleLinkedList &other)
+      : IndexedSingleLinkedList(
+            other, Allocator(SlotTraits::select_on_container_copy_construction(
+                       other.alloc_))) {}
+
+  // Копирует other в буфер, размещаемый аллокатором alloc
+  IndexedSingleLinkedList(const IndexedSingleLinkedList &other,
+                          const Allocator &alloc)
+      : alloc_(alloc) {
+    if (other.capacity_ == 0) {
+      return;
+    }
+    slots_ = SlotTraits::allocate(alloc_, other.capacity_);
+    capacity_ = other.capacity_;
+    if constexpr (kIsBitwiseCopyable) {
+      std::memcpy(static_cast<void *>(slots_), other.slots_,
+                  other.used_ * sizeof(Slot));
+    } else {
+      CopyLinks(other);
+      Index copied = other.head_;
+      try {
+        for (; copied != kNull; copied = other.slots_[copied].next) {
+          SlotTraits::construct(alloc_, slots_[copied].Value(),
+                                *other.slots_[copied].Value());
+        }
+      } catch (...) {
+        for (Index i = other.head_; i != copied; i = other.slots_[i].next) {
+          SlotTraits::destroy(alloc_, slots_[i].Value());
+        }
+        SlotTraits::deallocate(alloc_, slots_, capacity_);
+        throw;
+      }
+    }
+    CopyState(other);
+  }
+
+  IndexedSingleLinkedList(IndexedSingleLinkedList &&other) noexcept
+      : alloc_(other.alloc_) {
+    SwapStorage(other);
+  }
+
+  // Использует идиому copy-and-swap, обеспечивая строгую гарантию
+  // безопасности исключений. Копия размещается аллокатором, который список
+  // будет использовать после присваивания
+  IndexedSingleLinkedList &operator=(const IndexedSingleLinkedList &rhs) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if constexpr (SlotTraits::propagate_on_container_copy_assignment::value) {
+      if (alloc_ != rhs.alloc_) {
+        // Прежний буфер освобождается вместе с tmp прежним аллокатором
+        IndexedSingleLinkedList tmp(rhs, Allocator(rhs.alloc_));
+        SwapStorage(tmp);
+        std::swap(alloc_, tmp.alloc_);
+        return *this;
+      }
+    }
+    IndexedSingleLinkedList tmp(rhs, get_allocator());
+    SwapStorage(tmp);
+    return *this;
+  }
+
+  // Если аллокатор не распространяется при перемещении и аллокаторы списков
+  // не равны, элементы rhs перемещаются в новый буфер по одному
+  IndexedSingleLinkedList &operator=(IndexedSingleLinkedList &&rhs) noexcept(
+      SlotTraits::propagate_on_container_move_assignment::value ||
+      SlotTraits::is_always_equal::value) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if constexpr (SlotTraits::propagate_on_container_move_assignment::value) {
+      Release();
+      alloc_ = rhs.alloc_;
+      SwapStorage(rhs);
+    } else {
+      if (alloc_ == rhs.alloc_) {
+        Release();
+        SwapStorage(rhs);
+      } else {
+        IndexedSingleLinkedList tmp(get_allocator());
+        tmp.Reserve(rhs.size_);
+        for (Type &value : rhs) {
+          tmp.PushBack(std::move(value));
+        }
+        SwapStorage(tmp);
+        rhs.Release();
+      }
+    }
+    return *this;
+  }
+
+  ~IndexedSingleLinkedList() { Release(); }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  [[nodiscard]] Iterator begin() noexcept { return Iterator(this, head_); }
+  [[nodiscard]] Iterator end() noexcept { return Iterator(this, kNull); }
+  [[nodiscard]] ConstIterator begin() const noexcept { return cbegin(); }
+  [[nodiscard]] ConstIterator end() const noexcept { return cend(); }
+  [[nodiscard]] ConstIterator cbegin() const noexcept {
+    return ConstIterator(this, head_);
+  }
+  [[nodiscard]] ConstIterator cend() const noexcept {
+    return ConstIterator(this, kNull);
+  }
+
+  [[nodiscard]] Iterator before_begin() noexcept {
+    return Iterator(this, kHead);
+  }
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return ConstIterator(this, kHead);
+  }
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return cbefore_begin();
+  }
+
+  [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0; }
+
+  // Возвращает количество узлов, помещающихся в буфер
+  [[nodiscard]] size_t GetCapacity() const noexcept { return capacity_; }
+
+  // Увеличивает буфер так, чтобы он вмещал не менее capacity узлов
+  void Reserve(size_t capacity) {
+    if (capacity > capacity_) {
+      Reallocate(capacity);
+    }
+  }
+
+  void PushFront(const Type &value) { EmplaceFront(value); }
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  template <typename... Args>
+  Type &EmplaceFront(Args &&...args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+  }
+
+  void PushBack(const Type &value) { EmplaceBack(value); }
+  void PushBack(Type &&value) { EmplaceBack(std::move(value)); }
+
+  template <typename... Args>
+  Type &EmplaceBack(Args &&...args) {
+    return *EmplaceAfter(ConstIterator(this, tail_),
+                         std::forward<Args>(args)...);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  /*
+   * Конструирует элемент после pos и возвращает итератор на него
+   * Аргументы могут ссылаться на элементы самого списка. Исключение при
+   * конструировании оставляет список без изменений
+   */
+  template <typename... Args>
+  Iterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    assert(pos.list_ == this && pos.index_ != kNull);
+    Index index;
+    if (free_ == kNull && used_ == capacity_) {
+      index = EmplaceGrowing(std::forward<Args>(args)...);
+    } else {
+      index = AcquireSlot();
+      try {
+        SlotTraits::construct(alloc_, slots_[index].Value(),
+                              std::forward<Args>(args)...);
+      } catch (...) {
+        ReleaseSlot(index);
+        throw;
+      }
+    }
+    Index &link = LinkOf(pos.index_);
+    slots_[index].next = link;
+    link = index;
+    if (tail_ == pos.index_) {
+      tail_ = index;
+    }
+    ++size_;
+    return Iterator(this, index);
+  }
+
+  void PopFront() noexcept { EraseAfter(cbefore_begin()); }
+
+  // Удаляет элемент, следующий за pos, и возвращает итератор на элемент,
+  // следующий за удалённым. Узел удалённого элемента становится свободным
+  Iterator EraseAfter(ConstIterator pos) noexcept {
+    assert(pos.list_ == this && NextOf(pos.index_) != kNull);
+    Index &link = LinkOf(pos.index_);
+    const Index target = link;
+    link = slots_[target].next;
+    if (tail_ == target) {
+      tail_ = pos.index_;
+    }
+    SlotTraits::destroy(alloc_, slots_[target].Value());
+    ReleaseSlot(target);
+    --size_;
+    return Iterator(this, link);
+  }
+
+  // Удаляет все элементы, сохраняя буфер
+  void Clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+      for (Index i = head_; i != kNull; i = slots_[i].next) {
+        SlotTraits::destroy(alloc_, slots_[i].Value());
+      }
+    }
+    head_ = kNull;
+    tail_ = kHead;
+    free_ = kNull;
+    used_ = 0;
+    size_ = 0;
+  }
+
+  void swap(IndexedSingleLinkedList &other) noexcept {
+    if constexpr (SlotTraits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc_, other.alloc_);
+    } else {
+      assert(alloc_ == other.alloc_);
+    }
+    SwapStorage(other);
+  }
+
+ private:
+  Index NextOf(Index index) const noexcept {
+    return index == kHead ? head_ : slots_[index].next;
+  }
+
+  // Возвращает ссылку на поле, хранящее индекс узла, следующего за index
+  Index &LinkOf(Index index) noexcept {
+    return index == kHead ? head_ : slots_[index].next;
+  }
+
+  // Возвращает индекс свободного узла. В буфере должен быть свободный или
+  // ещё не выданный узел
+  Index AcquireSlot() noexcept {
+    if (free_ != kNull) {
+      const Index index = free_;
+      free_ = slots_[index].next;
+      return index;
+    }
+    return static_cast<Index>(used_++);
+  }
+
+  // Увеличивает заполненный буфер и возвращает индекс нового узла. Как в
+  // std::vector, элемент конструируется в новом буфере до переноса прежних
+  // элементов, поэтому аргументы могут ссылаться на элементы списка
+  template <typename... Args>
+  Index EmplaceGrowing(Args &&...args) {
+    if (capacity_ == kMaxSize) {
+      throw std::length_error("IndexedSingleLinkedList is full");
+    }
+    const size_t capacity =
+        std::min(std::max<size_t>(capacity_ * 2, 8), kMaxSize);
+    Slot *slots = SlotTraits::allocate(alloc_, capacity);
+    const Index index = static_cast<Index>(used_);
+    try {
+      SlotTraits::construct(alloc_, slots[index].Value(),
+                            std::forward<Args>(args)...);
+    } catch (...) {
+      SlotTraits::deallocate(alloc_, slots, capacity);
+      throw;
+    }
+    MoveSlotsTo(slots, capacity);
+    ++used_;
+    return index;
+  }
+
+  void ReleaseSlot(Index index) noexcept {
+    slots_[index].next = free_;
+    free_ = index;
+  }
+
+  // Переносит узлы в новый буфер вместимостью capacity, сохраняя их индексы
+  void Reallocate(size_t capacity) {
+    if (capacity > kMaxSize) {
+      throw std::length_error("IndexedSingleLinkedList capacity is too large");
+    }
+    MoveSlotsTo(SlotTraits::allocate(alloc_, capacity), capacity);
+  }
+
+  // Переносит узлы в буфер slots вместимостью capacity, сохраняя их индексы,
+  // и освобождает прежний буфер
+  void MoveSlotsTo(Slot *slots, size_t capacity) noexcept {
+    if (slots_ != nullptr) {
+      if constexpr (kIsBitwiseCopyable) {
+        std::memcpy(static_cast<void *>(slots), slots_, used_ * sizeof(Slot));
+      } else {
+        // Перемещение элементов не должно выбрасывать исключений, иначе
+        // часть элементов оказалась бы в старом буфере, а часть — в новом
+        static_assert(std::is_nothrow_move_constructible_v<Type>,
+                      "Type must be trivially copyable or nothrow move "
+                      "constructible");
+        for (size_t i = 0; i < used_; ++i) {
+          slots[i].next = slots_[i].next;
+        }
+        for (Index i = head_; i != kNull; i = slots_[i].next) {
+          SlotTraits::construct(alloc_, slots[i].Value(),
+                                std::move(*slots_[i].Value()));
+          SlotTraits::destroy(alloc_, slots_[i].Value());
+        }
+      }
+      SlotTraits::deallocate(alloc_, slots_, capacity_);
+    }
+    slots_ = slots;
+    capacity_ = capacity;
+  }
+
+  // Разрушает элементы и освобождает буфер
+  void Release() noexcept {
+    Clear();
+    if (slots_ != nullptr) {
+      SlotTraits::deallocate(alloc_, slots_, capacity_);
+      slots_ = nullptr;
+      capacity_ = 0;
+    }
+  }
+
+  void CopyLinks(const IndexedSingleLinkedList &other) noexcept {
+    for (size_t i = 0; i < other.used_; ++i) {
+      slots_[i].next = other.slots_[i].next;
+    }
+  }
+
+  void CopyState(const IndexedSingleLinkedList &other) noexcept {
+    head_ = other.head_;
+    tail_ = other.tail_;
+    free_ = other.free_;
+    used_ = other.used_;
+    size_ = other.size_;
+  }
+
+  void SwapStorage(IndexedSingleLinkedList &other) noexcept {
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(free_, other.free_);
+    std::swap(used_, other.used_);
+    std::swap(size_, other.size_);
+  }
+
+  SlotAllocator alloc_;
+  Slot *slots_ = nullptr;
+  size_t capacity_ = 0;
+  // Индекс первого узла списка
+  Index head_ = kNull;
+  // Индекс последнего узла. У пустого списка равен kHead
+  Index tail_ = kHead;
+  // Первый узел списка свободных
+  Index free_ = kNull;
+  // Количество узлов в начале буфера, которые когда-либо использовались.
+  // Узлы за ними ещё не выдавались
+  size_t used_ = 0;
+  size_t size_ = 0;
+};
+
+template <typename Type, typename Allocator>
+void swap(IndexedSingleLinkedList<Type, Allocator> &lhs,
+          IndexedSingleLinkedList<Type, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator==(const IndexedSingleLinkedList<Type, Allocator> &lhs,
+                const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetSize() == rhs.GetSize() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, typename Allocator>
+bool operator!=(const IndexedSingleLinkedList<Type, Allocator> &lhs,
+                const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator>
+detail::ThreeWayResult CompareThreeWay(
+    const IndexedSingleLinkedList<Type, Allocator> &lhs,
+    const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::CompareThreeWay(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename Type, typename Allocator>
+bool operator<(const IndexedSingleLinkedList<Type, Allocator> &lhs,
+               const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator<=(const IndexedSingleLinkedList<Type, Allocator> &lhs,
+                const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator>(const IndexedSingleLinkedList<Type, Allocator> &lhs,
+               const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator>=(const IndexedSingleLinkedList<Type, Allocator> &lhs,
+                const IndexedSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}
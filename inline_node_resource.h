@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+
+/*
+ * Ресурс памяти с kSlotCount ячейками, размещёнными внутри самого ресурса
+ * Запросы не больше kSlotSize байт с выравниванием не строже
+ * kSlotAlignment обслуживаются из ячеек, пока есть свободные, остальные
+ * запросы передаются вышестоящему ресурсу. Освобождённые ячейки
+ * переиспользуются. Ячейки выдаются по порядку, а в список свободных
+ * попадают только после освобождения, поэтому создание ресурса не зависит
+ * от kSlotCount
+ * Ресурс не синхронизирован и не может быть перемещён, пока из него выделена
+ * память
+ */
+template <size_t kSlotSize, size_t kSlotAlignment, size_t kSlotCount>
+class InlineNodeResource : public std::pmr::memory_resource {
+ public:
+  explicit InlineNodeResource(
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : upstream_(upstream) {}
+
+  InlineNodeResource(const InlineNodeResource &) = delete;
+  InlineNodeResource &operator=(const InlineNodeResource &) = delete;
+
+  [[nodiscard]] std::pmr::memory_resource *GetUpstream() const noexcept {
+    return upstream_;
+  }
+
+  // Возвращает количество занятых ячеек
+  [[nodiscard]] size_t GetInlineCount() const noexcept { return inline_count_; }
+
+  // Сообщает, выделена ли память p из ячеек ресурса
+  [[nodiscard]] bool IsInline(const void *p) const noexcept {
+    const std::less<const void *> less;
+    return !less(p, slots_) && less(p, slots_ + kSlotCount);
+  }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(kSlotAlignment) unsigned char bytes[kSlotSize];
+  };
+
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    if (bytes <= kSlotSize && alignment <= kSlotAlignment) {
+      Slot *slot = nullptr;
+      if (free_slots_ != nullptr) {
+        slot = free_slots_;
+        free_slots_ = slot->next;
+      } else if (issued_ < kSlotCount) {
+        slot = &slots_[issued_++];
+      }
+      if (slot != nullptr) {
+        ++inline_count_;
+        return slot->bytes;
+      }
+    }
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+    if (IsInline(p)) {
+      Slot *slot = static_cast<Slot *>(p);
+      slot->next = free_slots_;
+      free_slots_ = slot;
+      --inline_count_;
+      return;
+    }
+    upstream_->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  Slot *free_slots_ = nullptr;
+  // Количество ячеек в начале массива, которые уже выдавались
+  size_t issued_ = 0;
+  size_t inline_count_ = 0;
+  Slot slots_[kSlotCount];
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+namespace detail {
+
+// Результат лексикографического сравнения двух последовательностей
+struct ThreeWayResult {
+  // Отрицательно, если первая последовательность меньше второй, положительно,
+  // если больше, и равно нулю, если последовательности эквивалентны
+  int order = 0;
+  // Истинно, если последовательности одинаковой длины и все их элементы
+  // попарно равны
+  bool equal = true;
+};
+
+/*
+ * Сравнивает диапазоны [first1, last1) и [first2, last2) за один проход
+ * Порядок совпадает с std::lexicographical_compare, а для равных элементов
+ * выполняется единственное сравнение ==
+ */
+template <typename InputIt1, typename InputIt2>
+constexpr ThreeWayResult CompareThreeWay(InputIt1 first1, InputIt1 last1,
+                                         InputIt2 first2, InputIt2 last2) {
+  ThreeWayResult result;
+  for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+    if (*first1 == *first2) {
+      continue;
+    }
+    if (*first1 < *first2) {
+      return {-1, false};
+    }
+    if (*first2 < *first1) {
+      return {1, false};
+    }
+    // Элементы эквивалентны, но не равны
+    result.equal = false;
+  }
+  if (first1 != last1) {
+    return {1, false};
+  }
+  if (first2 != last2) {
+    return {-1, false};
+  }
+  return result;
+}
+
+// Операторы сравнения списков, выраженные через результат CompareThreeWay
+constexpr bool IsLess(ThreeWayResult r) noexcept { return r.order < 0; }
+constexpr bool IsLessOrEqual(ThreeWayResult r) noexcept {
+  return r.equal || r.order < 0;
+}
+constexpr bool IsGreater(ThreeWayResult r) noexcept {
+  return !IsLessOrEqual(r);
+}
+constexpr bool IsGreaterOrEqual(ThreeWayResult r) noexcept {
+  return r.equal || r.order >= 0;
+}
+
+}  // namespace detail
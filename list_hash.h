@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+
+namespace detail {
+
+// Перемешивает биты значения хеша (финализатор SplitMix64), чтобы близкие
+// значения std::hash, например хеши последовательных целых чисел, давали
+// независимые результаты
+inline uint64_t MixHash(uint64_t value) noexcept {
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ull;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebull;
+  value ^= value >> 31;
+  return value;
+}
+
+// Добавляет хеш очередного элемента к хешу последовательности. Результат
+// зависит от порядка элементов
+inline size_t HashCombine(size_t seed, size_t value) noexcept {
+  return static_cast<size_t>(
+      MixHash(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) +
+                      (seed >> 2))));
+}
+
+/*
+ * Хеширует элементы [first, last) с учётом их порядка
+ * Количество элементов входит в хеш, поэтому последовательности разной длины
+ * из одинаковых элементов, например пустых строк, различаются
+ */
+template <typename InputIt>
+size_t HashRange(InputIt first, InputIt last, size_t size) {
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  std::hash<ValueType> hasher;
+  size_t seed = static_cast<size_t>(MixHash(size));
+  for (; first != last; ++first) {
+    seed = HashCombine(seed, hasher(*first));
+  }
+  return seed;
+}
+
+}  // namespace detail
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+/*
+ * Упреждающая загрузка узлов при обходе списка
+ * Включается макросом SLL_ENABLE_PREFETCH (опция CMake SLL_ENABLE_PREFETCH)
+ * Адрес следующего узла становится известен только после загрузки текущего,
+ * поэтому обход длинного списка, узлы которого разбросаны по памяти,
+ * простаивает на каждом переходе. С упреждающей загрузкой обход запрашивает
+ * узел, следующий за очередным, как только узнаёт его адрес, и загрузка
+ * совмещается с обработкой текущего элемента
+ * Для списков, узлы которых лежат в памяти по порядку или помещаются в кэш,
+ * упреждающая загрузка не нужна, поэтому по умолчанию она отключена
+ */
+
+#ifdef SLL_ENABLE_PREFETCH
+inline constexpr bool kListPrefetchEnabled = true;
+#else
+inline constexpr bool kListPrefetchEnabled = false;
+#endif
+
+namespace detail {
+
+inline constexpr size_t kCacheLineBytes = 64;
+// Наибольшее количество строк кэша объекта, запрашиваемых заранее
+inline constexpr size_t kMaxPrefetchLines = 4;
+
+// Запрашивает загрузку в кэш строк, занятых объектом *object, для чтения
+// Ничего не делает для nullptr
+template <typename Object>
+inline void PrefetchForRead(const Object *object) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  if (object == nullptr) {
+    return;
+  }
+  constexpr size_t kLines = std::min(
+      (sizeof(Object) + kCacheLineBytes - 1) / kCacheLineBytes,
+      kMaxPrefetchLines);
+  const char *bytes = reinterpret_cast<const char *>(object);
+  for (size_t line = 0; line < kLines; ++line) {
+    __builtin_prefetch(bytes + line * kCacheLineBytes, 0, 3);
+  }
+#else
+  (void)object;
+#endif
+}
+
+}  // namespace detail
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "single_linked_list.h"
+
+// Счётчики освобождения списков. Узлы учитываются вместе с запасом,
+// созданным Reserve
+struct ReclaimerStats {
+  uint64_t queued_lists = 0;
+  uint64_t queued_nodes = 0;
+  uint64_t reclaimed_lists = 0;
+  uint64_t reclaimed_nodes = 0;
+};
+
+/*
+ * Фоновое освобождение списков
+ * ReleaseAsync забирает все узлы списка за время O(1), как перемещение, и
+ * передаёт их потоку освобождения, который разрушает элементы и возвращает
+ * узлы аллокатору. Вызывающий поток не ждёт обхода длинного списка, а
+ * список остаётся пустым и пригодным к использованию
+ * Элементы разрушаются в потоке освобождения, поэтому их деструкторы не
+ * должны зависеть от потока. Аллокатор списка должен допускать
+ * освобождение памяти из другого потока (std::allocator,
+ * std::pmr::synchronized_pool_resource), а его ресурс — существовать, пока
+ * Drain не вернёт управление
+ * Деструктор дожидается освобождения всех переданных списков
+ */
+class ListReclaimer {
+ public:
+  ListReclaimer() : worker_([this] { Run(); }) {}
+
+  ListReclaimer(const ListReclaimer &) = delete;
+  ListReclaimer &operator=(const ListReclaimer &) = delete;
+
+  ~ListReclaimer() {
+    {
+      std::lock_guard guard(mutex_);
+      stopping_ = true;
+    }
+    ready_.notify_one();
+    worker_.join();
+  }
+
+  // Забирает узлы list и передаёт их на освобождение. Пустой список без
+  // запаса узлов не передаётся. Если памяти для постановки в очередь не
+  // хватит, выбрасывает std::bad_alloc, и список не изменяется
+  template <typename Type, typename Allocator>
+  void ReleaseAsync(SingleLinkedList<Type, Allocator> &list) {
+    const size_t nodes = list.GetCapacity();
+    if (nodes == 0) {
+      return;
+    }
+    Enqueue(new ListJob<SingleLinkedList<Type, Allocator>>(std::move(list),
+                                                           nodes));
+  }
+
+  template <typename Type, typename Allocator>
+  void ReleaseAsync(SingleLinkedList<Type, Allocator> &&list) {
+    ReleaseAsync(list);
+  }
+
+  // Дожидается освобождения всех списков, переданных до вызова
+  void Drain() {
+    std::unique_lock lock(mutex_);
+    drained_.wait(lock, [this] { return pending_lists_ == 0; });
+  }
+
+  [[nodiscard]] ReclaimerStats GetStats() const noexcept {
+    ReclaimerStats stats;
+    stats.queued_lists = queued_lists_.load(std::memory_order_relaxed);
+    stats.queued_nodes = queued_nodes_.load(std::memory_order_relaxed);
+    stats.reclaimed_lists = reclaimed_lists_.load(std::memory_order_relaxed);
+    stats.reclaimed_nodes = reclaimed_nodes_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  // Возвращает количество узлов, переданных, но ещё не освобождённых
+  // Освобождённые узлы читаются первыми: их счётчик увеличивается после
+  // счётчика переданных, поэтому разность не бывает отрицательной
+  [[nodiscard]] uint64_t GetPendingNodes() const noexcept {
+    const uint64_t reclaimed = reclaimed_nodes_.load(std::memory_order_acquire);
+    return queued_nodes_.load(std::memory_order_relaxed) - reclaimed;
+  }
+
+ private:
+  // Переданный список. Задания связаны в очередь собственными указателями,
+  // поэтому постановка в очередь не выделяет память и не выбрасывает
+  // исключений
+  struct Job {
+    explicit Job(size_t node_count) noexcept : nodes(node_count) {}
+    virtual ~Job() = default;
+
+    Job *next = nullptr;
+    size_t nodes;
+  };
+
+  template <typename List>
+  struct ListJob : Job {
+    ListJob(List &&source, size_t node_count) noexcept
+        : Job(node_count), list(std::move(source)) {}
+
+    List list;
+  };
+
+  void Enqueue(Job *job) noexcept {
+    // Счётчики переданных узлов увеличиваются до того, как поток
+    // освобождения увидит задание
+    queued_lists_.fetch_add(1, std::memory_order_relaxed);
+    queued_nodes_.fetch_add(job->nodes, std::memory_order_relaxed);
+    {
+      std::lock_guard guard(mutex_);
+      if (last_ == nullptr) {
+        first_ = job;
+      } else {
+        last_->next = job;
+      }
+      last_ = job;
+      ++pending_lists_;
+    }
+    ready_.notify_one();
+  }
+
+  // Забирает всю очередь за один захват мьютекса и освобождает списки без
+  // мьютекса, чтобы ReleaseAsync не ждал освобождения
+  void Run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+      ready_.wait(lock, [this] { return first_ != nullptr || stopping_; });
+      if (first_ == nullptr) {
+        return;
+      }
+      Job *job = std::exchange(first_, nullptr);
+      last_ = nullptr;
+      lock.unlock();
+      size_t reclaimed = 0;
+      while (job != nullptr) {
+        Job *next = job->next;
+        const size_t nodes = job->nodes;
+        delete job;
+        reclaimed_nodes_.fetch_add(nodes, std::memory_order_release);
+        reclaimed_lists_.fetch_add(1, std::memory_order_relaxed);
+        ++reclaimed;
+        job = next;
+      }
+      lock.lock();
+      pending_lists_ -= reclaimed;
+      if (pending_lists_ == 0) {
+        drained_.notify_all();
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::condition_variable drained_;
+  Job *first_ = nullptr;
+  Job *last_ = nullptr;
+  // Переданные списки, освобождение которых ещё не завершено
+  size_t pending_lists_ = 0;
+  bool stopping_ = false;
+  std::atomic<uint64_t> queued_lists_{0};
+  std::atomic<uint64_t> queued_nodes_{0};
+  std::atomic<uint64_t> reclaimed_lists_{0};
+  std::atomic<uint64_t> reclaimed_nodes_{0};
+  // Поток создаётся последним, когда остальные поля уже инициализированы
+  std::thread worker_;
+};
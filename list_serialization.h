@@ -0,0 +1,169 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "single_linked_list.h"
+
+/*
+ * Двоичный формат списков элементов с тривиальным копированием
+ * Файл состоит из заголовка ListFileHeader и следующих за ним байтов
+ * элементов в порядке списка. Элементы записываются в представлении и
+ * порядке байтов текущей платформы, поэтому читать файл следует на
+ * платформе с тем же представлением типа. Заголовок занимает
+ * kListFileDataOffset байт, так что элементы в отображённом в память
+ * файле выровнены для типов с выравниванием до kListFileDataOffset
+ */
+struct ListFileHeader {
+  char magic[4] = {'S', 'L', 'L', 'B'};
+  // Позволяет обнаружить файл, записанный с другим порядком байтов
+  uint32_t byte_order = kByteOrderMark;
+  uint64_t element_size = 0;
+  uint64_t element_alignment = 0;
+  uint64_t element_count = 0;
+
+  static constexpr uint32_t kByteOrderMark = 0x01020304;
+};
+
+inline constexpr size_t kListFileDataOffset = sizeof(ListFileHeader);
+static_assert(kListFileDataOffset == 32);
+
+namespace detail {
+
+// Размер блока, которым элементы передаются потоку
+inline constexpr size_t kSerializationBatchBytes = 64 * 1024;
+
+template <typename Type>
+constexpr void RequireSerializable() {
+  static_assert(std::is_trivially_copyable_v<Type>,
+                "Only trivially copyable elements can be serialized");
+  static_assert(alignof(Type) <= kListFileDataOffset,
+                "Element alignment exceeds the list file data offset");
+}
+
+// Память для блока элементов, выровненная для Type. Элементы не
+// конструируются: байты элементов с тривиальным копированием записываются
+// в неё напрямую
+template <typename Type>
+class ElementBuffer {
+ public:
+  explicit ElementBuffer(size_t size)
+      : data_(std::allocator<Type>().allocate(size)), size_(size) {}
+
+  ElementBuffer(const ElementBuffer &) = delete;
+  ElementBuffer &operator=(const ElementBuffer &) = delete;
+
+  ~ElementBuffer() { std::allocator<Type>().deallocate(data_, size_); }
+
+  [[nodiscard]] Type *GetData() const noexcept { return data_; }
+
+ private:
+  Type *data_;
+  size_t size_;
+};
+
+template <typename Type>
+ListFileHeader MakeListFileHeader(size_t count) noexcept {
+  ListFileHeader header;
+  header.element_size = sizeof(Type);
+  header.element_alignment = alignof(Type);
+  header.element_count = count;
+  return header;
+}
+
+// Проверяет, что заголовок описывает файл с элементами типа Type
+template <typename Type>
+void ValidateListFileHeader(const ListFileHeader &header) {
+  const ListFileHeader expected = MakeListFileHeader<Type>(0);
+  if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0) {
+    throw std::runtime_error("Not a list file");
+  }
+  if (header.byte_order != ListFileHeader::kByteOrderMark) {
+    throw std::runtime_error("List file has a different byte order");
+  }
+  if (header.element_size != sizeof(Type) ||
+      header.element_alignment != alignof(Type)) {
+    throw std::runtime_error("List file has a different element type");
+  }
+}
+
+}  // namespace detail
+
+/*
+ * Записывает элементы container в поток output в двоичном формате
+ * Container — любой список этой библиотеки или другой контейнер с методами
+ * GetSize, begin и end. Элементы передаются потоку блоками
+ * При ошибке записи выбрасывает std::runtime_error
+ */
+template <typename Container>
+void SerializeList(const Container &container, std::ostream &output) {
+  using Type = typename Container::value_type;
+  detail::RequireSerializable<Type>();
+
+  const ListFileHeader header =
+      detail::MakeListFileHeader<Type>(container.GetSize());
+  output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  constexpr size_t kBatchSize =
+      std::max<size_t>(detail::kSerializationBatchBytes / sizeof(Type), 1);
+  std::vector<unsigned char> buffer(kBatchSize * sizeof(Type));
+  size_t buffered = 0;
+  for (const Type &value : container) {
+    std::memcpy(buffer.data() + buffered * sizeof(Type), &value, sizeof(Type));
+    if (++buffered == kBatchSize) {
+      output.write(reinterpret_cast<const char *>(buffer.data()),
+                   static_cast<std::streamsize>(buffered * sizeof(Type)));
+      buffered = 0;
+    }
+  }
+  output.write(reinterpret_cast<const char *>(buffer.data()),
+               static_cast<std::streamsize>(buffered * sizeof(Type)));
+  if (!output) {
+    throw std::runtime_error("Failed to write list");
+  }
+}
+
+/*
+ * Читает из потока input список, записанный SerializeList
+ * Элементы читаются блоками и добавляются в конец списка. Если заголовок не
+ * соответствует типу Type или поток закончился раньше времени, выбрасывает
+ * std::runtime_error
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+SingleLinkedList<Type, Allocator> DeserializeList(
+    std::istream &input, const Allocator &alloc = Allocator()) {
+  detail::RequireSerializable<Type>();
+
+  ListFileHeader header;
+  if (!input.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+    throw std::runtime_error("Failed to read list header");
+  }
+  detail::ValidateListFileHeader<Type>(header);
+
+  constexpr size_t kBatchSize =
+      std::max<size_t>(detail::kSerializationBatchBytes / sizeof(Type), 1);
+  detail::ElementBuffer<Type> buffer(kBatchSize);
+  SingleLinkedList<Type, Allocator> list(alloc);
+  for (uint64_t remaining = header.element_count; remaining > 0;) {
+    const size_t batch =
+        static_cast<size_t>(std::min<uint64_t>(remaining, kBatchSize));
+    if (!input.read(reinterpret_cast<char *>(buffer.GetData()),
+                    static_cast<std::streamsize>(batch * sizeof(Type)))) {
+      throw std::runtime_error("List data is truncated");
+    }
+    for (const Type *value = buffer.GetData();
+         value != buffer.GetData() + batch; ++value) {
+      list.PushBack(*value);
+    }
+    remaining -= batch;
+  }
+  return list;
+}
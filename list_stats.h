@@ -0,0 +1,382 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Статистика работы списков
+ * Сбор статистики включается макросом SLL_ENABLE_STATS (опция CMake
+ * SLL_ENABLE_STATS). Без него функции сбора пусты и удаляются компилятором,
+ * а списки не содержат счётчиков, поэтому статистика не влияет ни на размер
+ * списков, ни на скорость их работы, а GetStats возвращает нули
+ * Каждый список ведёт собственную статистику и одновременно добавляет её к
+ * общей статистике всех списков программы. Счётчики отдельного списка не
+ * синхронизированы, как и сам список, а общие счётчики атомарны
+ */
+
+#ifdef SLL_ENABLE_STATS
+inline constexpr bool kListStatsEnabled = true;
+#else
+inline constexpr bool kListStatsEnabled = false;
+#endif
+
+// Гистограмма длительностей с корзинами по степеням двойки: корзина i
+// содержит количество длительностей от 2^(i-1) до 2^i - 1 наносекунд,
+// корзина 0 — нулевые длительности, последняя корзина — все более долгие
+struct LatencyHistogram {
+  static constexpr size_t kBucketCount = 40;
+
+  // Возвращает номер корзины для длительности nanoseconds
+  static size_t GetBucket(uint64_t nanoseconds) noexcept {
+    size_t bucket = 0;
+    while (nanoseconds != 0 && bucket + 1 < kBucketCount) {
+      nanoseconds >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  void Record(uint64_t nanoseconds) noexcept {
+    ++buckets[GetBucket(nanoseconds)];
+  }
+
+  // Возвращает общее количество записанных длительностей
+  [[nodiscard]] uint64_t GetCount() const noexcept {
+    uint64_t count = 0;
+    for (uint64_t bucket : buckets) {
+      count += bucket;
+    }
+    return count;
+  }
+
+  std::array<uint64_t, kBucketCount> buckets{};
+};
+
+/*
+ * Расположение узлов списка в памяти, измеренное по переходам между
+ * соседними элементами. Переход близкий, если следующий узел начинается не
+ * дальше kNearDistance байт после текущего: такие узлы обычно уже загружены
+ * в кэш вместе с текущим или запрошены аппаратной упреждающей загрузкой
+ * Переходы на другую страницу памяти дополнительно нагружают TLB
+ */
+struct ListLocality {
+  static constexpr uint64_t kNearDistance = 256;
+  static constexpr uint64_t kPageSize = 4096;
+
+  // Учитывает переход от узла from к узлу to
+  void RecordLink(const void *from, const void *to) noexcept {
+    const auto from_address = reinterpret_cast<uintptr_t>(from);
+    const auto to_address = reinterpret_cast<uintptr_t>(to);
+    ++links;
+    if (to_address > from_address &&
+        to_address - from_address <= kNearDistance) {
+      ++near_links;
+    }
+    if (from_address / kPageSize != to_address / kPageSize) {
+      ++page_changes;
+    }
+  }
+
+  ListLocality &operator+=(const ListLocality &other) noexcept {
+    links += other.links;
+    near_links += other.near_links;
+    page_changes += other.page_changes;
+    return *this;
+  }
+
+  // Возвращает долю близких переходов, 1 для списков без переходов
+  [[nodiscard]] double GetNearFraction() const noexcept {
+    return links == 0 ? 1.0
+                      : static_cast<double>(near_links) /
+                            static_cast<double>(links);
+  }
+
+  uint64_t links = 0;
+  uint64_t near_links = 0;
+  uint64_t page_changes = 0;
+};
+
+// Статистика списка или всех списков программы
+struct ListStats {
+  // Узлы, полученные от аллокатора и возвращённые ему
+  uint64_t node_allocations = 0;
+  uint64_t node_deallocations = 0;
+  uint64_t copy_constructions = 0;
+  uint64_t copy_assignments = 0;
+  uint64_t move_constructions = 0;
+  uint64_t move_assignments = 0;
+  // Вызовы operator== и лексикографических сравнений
+  uint64_t comparisons = 0;
+  uint64_t clears = 0;
+  // Наибольшая достигнутая длина списка
+  uint64_t max_size = 0;
+  // Узлы, перенесённые Compact и CompactAfter, и расположение перенесённых
+  // участков до и после переноса
+  uint64_t relocated_nodes = 0;
+  ListLocality relayout_before;
+  ListLocality relayout_after;
+  // Длительности копирующего и перемещающего operator= и Clear
+  LatencyHistogram assign_latency;
+  LatencyHistogram clear_latency;
+};
+
+namespace detail {
+
+// Общая статистика всех списков
+struct GlobalListStats {
+  struct Histogram {
+    void Record(uint64_t nanoseconds) noexcept {
+      buckets[LatencyHistogram::GetBucket(nanoseconds)].fetch_add(
+          1, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, LatencyHistogram::kBucketCount> buckets{};
+  };
+
+  struct Locality {
+    void Add(const ListLocality &locality) noexcept {
+      links.fetch_add(locality.links, std::memory_order_relaxed);
+      near_links.fetch_add(locality.near_links, std::memory_order_relaxed);
+      page_changes.fetch_add(locality.page_changes, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] ListLocality Load() const noexcept {
+      ListLocality result;
+      result.links = links.load(std::memory_order_relaxed);
+      result.near_links = near_links.load(std::memory_order_relaxed);
+      result.page_changes = page_changes.load(std::memory_order_relaxed);
+      return result;
+    }
+
+    void Reset() noexcept {
+      for (auto *counter : {&links, &near_links, &page_changes}) {
+        counter->store(0, std::memory_order_relaxed);
+      }
+    }
+
+    std::atomic<uint64_t> links{0};
+    std::atomic<uint64_t> near_links{0};
+    std::atomic<uint64_t> page_changes{0};
+  };
+
+  std::atomic<uint64_t> node_allocations{0};
+  std::atomic<uint64_t> node_deallocations{0};
+  std::atomic<uint64_t> copy_constructions{0};
+  std::atomic<uint64_t> copy_assignments{0};
+  std::atomic<uint64_t> move_constructions{0};
+  std::atomic<uint64_t> move_assignments{0};
+  std::atomic<uint64_t> comparisons{0};
+  std::atomic<uint64_t> clears{0};
+  std::atomic<uint64_t> max_size{0};
+  std::atomic<uint64_t> relocated_nodes{0};
+  Locality relayout_before;
+  Locality relayout_after;
+  Histogram assign_latency;
+  Histogram clear_latency;
+};
+
+inline GlobalListStats &GetGlobalListStatsStorage() noexcept {
+  static GlobalListStats stats;
+  return stats;
+}
+
+inline void Increment(uint64_t &local, std::atomic<uint64_t> &global) noexcept {
+  ++local;
+  global.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*
+ * Счётчики одного списка. Список наследует записывающий класс закрыто, и
+ * без SLL_ENABLE_STATS тот не содержит данных, поэтому не увеличивает размер
+ * списка
+ * Методы записи константны, так как сравнения выполняются над
+ * константными списками
+ */
+template <bool kEnabled = kListStatsEnabled>
+class ListStatsRecorder {
+ public:
+  // Замеряет длительность операции от создания до разрушения
+  class Timer {
+   public:
+    // Пользовательский деструктор подавляет предупреждение о неиспользуемой
+    // переменной с таймером
+    ~Timer() {}
+  };
+
+  [[nodiscard]] ListStats GetStats() const noexcept { return {}; }
+  void ResetStats() noexcept {}
+
+ protected:
+  void RecordNodeAllocation() const noexcept {}
+  void RecordNodeDeallocation() const noexcept {}
+  void RecordCopyConstruction() const noexcept {}
+  void RecordCopyAssignment() const noexcept {}
+  void RecordMoveConstruction() const noexcept {}
+  void RecordMoveAssignment() const noexcept {}
+  void RecordComparison() const noexcept {}
+  void RecordClear() const noexcept {}
+  void RecordSize(size_t) const noexcept {}
+  void RecordRelayout(size_t, const ListLocality &,
+                      const ListLocality &) const noexcept {}
+  [[nodiscard]] Timer TimeAssignment() const noexcept { return Timer(); }
+  [[nodiscard]] Timer TimeClear() const noexcept { return Timer(); }
+};
+
+template <>
+class ListStatsRecorder<true> {
+ public:
+  class Timer {
+   public:
+    Timer(LatencyHistogram &local, GlobalListStats::Histogram &global) noexcept
+        : local_(local),
+          global_(global),
+          start_(std::chrono::steady_clock::now()) {}
+
+    Timer(const Timer &) = delete;
+    Timer &operator=(const Timer &) = delete;
+
+    ~Timer() {
+      const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start_);
+      const auto nanoseconds = static_cast<uint64_t>(elapsed.count());
+      local_.Record(nanoseconds);
+      global_.Record(nanoseconds);
+    }
+
+   private:
+    LatencyHistogram &local_;
+    GlobalListStats::Histogram &global_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  // Статистика не копируется вместе со списком: каждый объект списка
+  // ведёт свою
+  ListStatsRecorder() = default;
+  ListStatsRecorder(const ListStatsRecorder &) noexcept {}
+  ListStatsRecorder &operator=(const ListStatsRecorder &) noexcept {
+    return *this;
+  }
+
+  [[nodiscard]] ListStats GetStats() const noexcept { return stats_; }
+  void ResetStats() noexcept { stats_ = ListStats(); }
+
+ protected:
+  void RecordNodeAllocation() const noexcept {
+    Increment(stats_.node_allocations, Global().node_allocations);
+  }
+  void RecordNodeDeallocation() const noexcept {
+    Increment(stats_.node_deallocations, Global().node_deallocations);
+  }
+  void RecordCopyConstruction() const noexcept {
+    Increment(stats_.copy_constructions, Global().copy_constructions);
+  }
+  void RecordCopyAssignment() const noexcept {
+    Increment(stats_.copy_assignments, Global().copy_assignments);
+  }
+  void RecordMoveConstruction() const noexcept {
+    Increment(stats_.move_constructions, Global().move_constructions);
+  }
+  void RecordMoveAssignment() const noexcept {
+    Increment(stats_.move_assignments, Global().move_assignments);
+  }
+  void RecordComparison() const noexcept {
+    Increment(stats_.comparisons, Global().comparisons);
+  }
+  void RecordClear() const noexcept {
+    Increment(stats_.clears, Global().clears);
+  }
+
+  void RecordSize(size_t size) const noexcept {
+    if (size <= stats_.max_size) {
+      return;
+    }
+    stats_.max_size = size;
+    std::atomic<uint64_t> &global = Global().max_size;
+    uint64_t current = global.load(std::memory_order_relaxed);
+    while (current < size &&
+           !global.compare_exchange_weak(current, size,
+                                         std::memory_order_relaxed)) {
+    }
+  }
+
+  void RecordRelayout(size_t nodes, const ListLocality &before,
+                      const ListLocality &after) const noexcept {
+    stats_.relocated_nodes += nodes;
+    stats_.relayout_before += before;
+    stats_.relayout_after += after;
+    GlobalListStats &global = Global();
+    global.relocated_nodes.fetch_add(nodes, std::memory_order_relaxed);
+    global.relayout_before.Add(before);
+    global.relayout_after.Add(after);
+  }
+
+  [[nodiscard]] Timer TimeAssignment() const noexcept {
+    return Timer(stats_.assign_latency, Global().assign_latency);
+  }
+
+  [[nodiscard]] Timer TimeClear() const noexcept {
+    return Timer(stats_.clear_latency, Global().clear_latency);
+  }
+
+ private:
+  static GlobalListStats &Global() noexcept {
+    return GetGlobalListStatsStorage();
+  }
+
+  mutable ListStats stats_;
+};
+
+}  // namespace detail
+
+// Возвращает общую статистику всех списков программы. Без SLL_ENABLE_STATS
+// возвращает нули
+inline ListStats GetGlobalListStats() noexcept {
+  ListStats result;
+  if constexpr (kListStatsEnabled) {
+    const detail::GlobalListStats &global = detail::GetGlobalListStatsStorage();
+    auto load = [](const std::atomic<uint64_t> &counter) {
+      return counter.load(std::memory_order_relaxed);
+    };
+    result.node_allocations = load(global.node_allocations);
+    result.node_deallocations = load(global.node_deallocations);
+    result.copy_constructions = load(global.copy_constructions);
+    result.copy_assignments = load(global.copy_assignments);
+    result.move_constructions = load(global.move_constructions);
+    result.move_assignments = load(global.move_assignments);
+    result.comparisons = load(global.comparisons);
+    result.clears = load(global.clears);
+    result.max_size = load(global.max_size);
+    result.relocated_nodes = load(global.relocated_nodes);
+    result.relayout_before = global.relayout_before.Load();
+    result.relayout_after = global.relayout_after.Load();
+    for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+      result.assign_latency.buckets[i] = load(global.assign_latency.buckets[i]);
+      result.clear_latency.buckets[i] = load(global.clear_latency.buckets[i]);
+    }
+  }
+  return result;
+}
+
+// Обнуляет общую статистику. Статистика отдельных списков не изменяется
+inline void ResetGlobalListStats() noexcept {
+  if constexpr (kListStatsEnabled) {
+    detail::GlobalListStats &global = detail::GetGlobalListStatsStorage();
+    for (auto *counter :
+         {&global.node_allocations, &global.node_deallocations,
+          &global.copy_constructions, &global.copy_assignments,
+          &global.move_constructions, &global.move_assignments,
+          &global.comparisons, &global.clears, &global.max_size,
+          &global.relocated_nodes}) {
+      counter->store(0, std::memory_order_relaxed);
+    }
+    global.relayout_before.Reset();
+    global.relayout_after.Reset();
+    for (size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+      global.assign_latency.buckets[i].store(0, std::memory_order_relaxed);
+      global.clear_latency.buckets[i].store(0, std::memory_order_relaxed);
+    }
+  }
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/*
+ * Односвязный список с блокировкой отдельных узлов для одновременных вставок
+ * и удалений в середине списка
+ * Каждый узел защищён собственным мьютексом, поэтому операции над разными
+ * участками списка выполняются параллельно. InsertAfter блокирует только узел
+ * pos, EraseAfter — узел pos и удаляемый узел, а RemoveIf проходит список,
+ * удерживая не более двух соседних узлов (hand-over-hand locking)
+ * Удаление ленивое: удалённый узел помечается, а память освобождается, когда
+ * на узел не остаётся итераторов. Поэтому итератор, полученный одним потоком,
+ * остаётся разыменовываемым, даже если другой поток удалит его элемент.
+ * Вставка после удалённого узла не выполняется и возвращает end()
+ * Сами значения элементов мьютексами не защищаются: одновременное изменение
+ * одного и того же элемента должен синхронизировать вызывающий код
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class LockCouplingSingleLinkedList {
+  struct NodeBase {
+    std::mutex mutex;
+    // Узел исключён из списка. Изменяется под мьютексом узла
+    bool erased = false;
+    std::shared_ptr<NodeBase> next_node;
+  };
+
+  struct Node : NodeBase {
+    template <typename... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    Type value;
+  };
+
+  // Шаблон класса «Базовый Итератор»
+  // Определяет поведение итератора на элементы односвязного списка
+  // ValueType — совпадает с Type (для Iterator) либо с const Type (для
+  // ConstIterator)
+  // Итератор владеет узлом, на который указывает, поэтому узел не будет
+  // освобождён, пока существует итератор
+  template <typename ValueType>
+  class BasicIterator {
+    friend class LockCouplingSingleLinkedList;
+
+    explicit BasicIterator(std::shared_ptr<NodeBase> node)
+        : node_(std::move(node)) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    // При ValueType, совпадающем с const Type, играет роль конвертирующего
+    // конструктора
+    BasicIterator(const BasicIterator<Type> &other) noexcept
+        : node_(other.node_) {}
+
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    [[nodiscard]] bool operator==(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return node_ == rhs.node_;
+    }
+
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return node_ != rhs.node_;
+    }
+
+    [[nodiscard]] bool operator==(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return node_ == rhs.node_;
+    }
+
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return node_ != rhs.node_;
+    }
+
+    // Переходит к следующему элементу, на короткое время блокируя текущий
+    // узел. Если текущий элемент был удалён, итератор переходит к элементу,
+    // который следовал за ним в момент удаления
+    BasicIterator &operator++() {
+      // Текущий узел может быть освобождён при смене node_, поэтому он
+      // удерживается до снятия блокировки
+      const std::shared_ptr<NodeBase> current = node_;
+      std::lock_guard guard(current->mutex);
+      node_ = current->next_node;
+      return *this;
+    }
+
+    BasicIterator operator++(int) {
+      auto old_value(*this);
+      ++(*this);
+      return old_value;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+      return static_cast<Node *>(node_.get())->value;
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+      return &static_cast<Node *>(node_.get())->value;
+    }
+
+   private:
+    std::shared_ptr<NodeBase> node_;
+  };
+
+ public:
+  using value_type = Type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using allocator_type = Allocator;
+
+  using Iterator = BasicIterator<Type>;
+  using ConstIterator = BasicIterator<const Type>;
+
+  LockCouplingSingleLinkedList()
+      : LockCouplingSingleLinkedList(Allocator()) {}
+
+  explicit LockCouplingSingleLinkedList(const Allocator &alloc)
+      : alloc_(alloc), head_(std::allocate_shared<NodeBase>(alloc_)) {}
+
+  LockCouplingSingleLinkedList(std::initializer_list<Type> values,
+                               const Allocator &alloc = Allocator())
+      : LockCouplingSingleLinkedList(alloc) {
+    auto pos = before_begin();
+    for (const Type &value : values) {
+      pos = InsertAfter(pos, value);
+    }
+  }
+
+  LockCouplingSingleLinkedList(const LockCouplingSingleLinkedList &) = delete;
+  LockCouplingSingleLinkedList &operator=(
+      const LockCouplingSingleLinkedList &) = delete;
+
+  // Деструктор не должен выполняться одновременно с другими операциями
+  // Узлы освобождаются по одному, чтобы длинная цепочка не разрушалась
+  // рекурсивно. Узлы, на которые ещё ссылаются итераторы, остаются живы
+  ~LockCouplingSingleLinkedList() {
+    std::shared_ptr<NodeBase> node = std::move(head_->next_node);
+    while (node != nullptr && node.use_count() == 1) {
+      node = std::move(node->next_node);
+    }
+  }
+
+  [[nodiscard]] Allocator get_allocator() const noexcept {
+    return Allocator(alloc_);
+  }
+
+  // Возвращает количество элементов. При одновременных изменениях значение
+  // является моментальным снимком
+  [[nodiscard]] size_t GetSize() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return GetSize() == 0; }
+
+  [[nodiscard]] Iterator before_begin() noexcept { return Iterator(head_); }
+
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return ConstIterator(head_);
+  }
+
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return before_begin();
+  }
+
+  [[nodiscard]] Iterator begin() { return ++before_begin(); }
+
+  [[nodiscard]] ConstIterator begin() const { return ++before_begin(); }
+
+  [[nodiscard]] ConstIterator cbegin() const { return begin(); }
+
+  [[nodiscard]] Iterator end() noexcept { return Iterator(); }
+
+  [[nodiscard]] ConstIterator end() const noexcept { return ConstIterator(); }
+
+  [[nodiscard]] ConstIterator cend() const noexcept { return end(); }
+
+  void PushFront(const Type &value) { EmplaceAfter(cbefore_begin(), value); }
+
+  void PushFront(Type &&value) {
+    EmplaceAfter(cbefore_begin(), std::move(value));
+  }
+
+  template <typename... Args>
+  void EmplaceFront(Args &&...args) {
+    EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  /*
+   * Конструирует элемент после pos и возвращает итератор на него
+   * Блокируется только узел pos. Если элемент pos уже удалён другим потоком,
+   * вставка не выполняется и возвращается end()
+   */
+  template <typename... Args>
+  Iterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    assert(pos.node_ != nullptr);
+    std::shared_ptr<NodeBase> node =
+        std::allocate_shared<Node>(alloc_, std::forward<Args>(args)...);
+    std::lock_guard guard(pos.node_->mutex);
+    if (pos.node_->erased) {
+      return end();
+    }
+    node->next_node = std::move(pos.node_->next_node);
+    pos.node_->next_node = node;
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return Iterator(std::move(node));
+  }
+
+  void PopFront() { EraseAfter(cbefore_begin()); }
+
+  /*
+   * Удаляет элемент, следующий за pos. Блокирует узел pos, а затем удаляемый
+   * узел, в порядке следования узлов в списке
+   * Возвращает false, если элемент pos удалён другим потоком или за ним нет
+   * элемента
+   */
+  bool EraseAfter(ConstIterator pos) {
+    assert(pos.node_ != nullptr);
+    std::shared_ptr<NodeBase> victim;
+    {
+      std::lock_guard guard(pos.node_->mutex);
+      if (pos.node_->erased || pos.node_->next_node == nullptr) {
+        return false;
+      }
+      victim = pos.node_->next_node;
+      std::lock_guard victim_guard(victim->mutex);
+      victim->erased = true;
+      // Удалённый узел сохраняет ссылку на следующий, чтобы итераторы на
+      // него могли продолжить обход
+      pos.node_->next_node = victim->next_node;
+    }
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    // Если на узел нет итераторов, он освобождается здесь, уже после снятия
+    // блокировок
+    return true;
+  }
+
+  /*
+   * Удаляет все элементы, для которых pred возвращает true, и возвращает их
+   * количество
+   * Проход удерживает блокировки предыдущего и текущего узлов, поэтому
+   * другие потоки могут одновременно изменять ещё не пройденную часть списка
+   */
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred) {
+    size_t removed = 0;
+    std::shared_ptr<NodeBase> prev = head_;
+    std::unique_lock prev_lock(prev->mutex);
+    while (prev->next_node != nullptr) {
+      std::shared_ptr<NodeBase> current = prev->next_node;
+      std::unique_lock current_lock(current->mutex);
+      if (pred(static_cast<const Node &>(*current).value)) {
+        current->erased = true;
+        prev->next_node = current->next_node;
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        ++removed;
+      } else {
+        prev_lock = std::move(current_lock);
+        prev = std::move(current);
+      }
+    }
+    return removed;
+  }
+
+ private:
+  using NodeBaseAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<NodeBase>;
+
+  NodeBaseAllocator alloc_;
+  std::shared_ptr<NodeBase> head_;
+  std::atomic<size_t> size_{0};
+};
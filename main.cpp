@@ -1,361 +1,45 @@
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
-template <typename Type>
-class SingleLinkedList {
-  // Узел списка
-  struct Node {
-    Node() = default;
-    Node(const Type &val, Node *next) : value(val), next_node(next) {}
-    Type value;
-    Node *next_node = nullptr;
-  };
-
-  template <typename ValueType>
-  class BasicIterator {
-    friend class SingleLinkedList;
-    // Конвертирующий конструктор итератора из указателя на узел списка
-    explicit BasicIterator(Node *node) : node_(node) {}
-
-   public:
-    // Объявленные ниже типы сообщают стандартной библиотеке о свойствах этого
-    // итератора
-
-    // Категория итератора — forward iterator
-    // (итератор, который поддерживает операции инкремента и многократное
-    // разыменование)
-    using iterator_category = std::forward_iterator_tag;
-    // Тип элементов, по которым перемещается итератор
-    using value_type = Type;
-    // Тип, используемый для хранения смещения между итераторами
-    using difference_type = std::ptrdiff_t;
-    // Тип указателя на итерируемое значение
-    using pointer = ValueType *;
-    // Тип ссылки на итерируемое значение
-    using reference = ValueType &;
-
-    BasicIterator() = default;
-
-    // Конвертирующий конструктор/конструктор копирования
-    // При ValueType, совпадающем с Type, играет роль копирующего конструктора
-    // При ValueType, совпадающем с const Type, играет роль конвертирующего
-    // конструктора
-    BasicIterator(const BasicIterator<Type> &other) noexcept {
-      node_ = other.node_;
-    }
-
-    // Чтобы компилятор не выдавал предупреждение об отсутствии оператора = при
-    // наличии пользовательского конструктора копирования, явно объявим оператор
-    // = и попросим компилятор сгенерировать его за нас
-    BasicIterator &operator=(const BasicIterator &rhs) = default;
-
-    // Оператор сравнения итераторов (в роли второго аргумента выступает
-    // константный итератор) Два итератора равны, если они ссылаются на один и
-    // тот же элемент списка либо на end()
-    [[nodiscard]] bool operator==(
-        const BasicIterator<const Type> &rhs) const noexcept {
-      return (node_ == rhs.node_);
-    }
-
-    // Оператор проверки итераторов на неравенство
-    // Противоположен !=
-    [[nodiscard]] bool operator!=(
-        const BasicIterator<const Type> &rhs) const noexcept {
-      return (node_ != rhs.node_);
-    }
-
-    // Оператор сравнения итераторов (в роли второго аргумента итератор)
-    // Два итератора равны, если они ссылаются на один и тот же элемент списка
-    // либо на end()
-    [[nodiscard]] bool operator==(
-        const BasicIterator<Type> &rhs) const noexcept {
-      return (node_ == rhs.node_);
-    }
-
-    // Оператор проверки итераторов на неравенство
-    // Противоположен !=
-    [[nodiscard]] bool operator!=(
-        const BasicIterator<Type> &rhs) const noexcept {
-      return node_ != rhs.node_;
-    }
-
-    // Оператор прединкремента. После его вызова итератор указывает на следующий
-    // элемент списка Возвращает ссылку на самого себя Инкремент итератора, не
-    // указывающего на существующий элемент списка, приводит к неопределённому
-    // поведению
-    BasicIterator &operator++() noexcept {
-      node_ = node_->next_node;
-      return *this;
-    }
-
-    // Оператор постинкремента. После его вызова итератор указывает на следующий
-    // элемент списка Возвращает прежнее значение итератора Инкремент итератора,
-    // не указывающего на существующий элемент списка, приводит к
-    // неопределённому поведению
-    BasicIterator operator++(int) noexcept {
-      BasicIterator this_prev(node_);
-      node_ = node_->next_node;
-      return this_prev;
-    }
-
-    // Операция разыменования. Возвращает ссылку на текущий элемент
-    // Вызов этого оператора у итератора, не указывающего на существующий
-    // элемент списка, приводит к неопределённому поведению
-    [[nodiscard]] reference operator*() const noexcept { return node_->value; }
-
-    // Операция доступа к члену класса. Возвращает указатель на текущий элемент
-    // списка Вызов этого оператора у итератора, не указывающего на существующий
-    // элемент списка, приводит к неопределённому поведению
-    [[nodiscard]] pointer operator->() const noexcept { return &node_->value; }
-
-   private:
-    Node *node_ = nullptr;
-  };
-
- public:
-  using value_type = Type;
-  using reference = value_type &;
-  using const_reference = const value_type &;
-  // Итератор, допускающий изменение элементов списка
-  using Iterator = BasicIterator<Type>;
-  // Константный итератор, предоставляющий доступ для чтения к элементам списка
-  using ConstIterator = BasicIterator<const Type>;
-
-  // Возвращает итератор, ссылающийся на первый элемент
-  // Если список пустой, возвращённый итератор будет равен end()
-  [[nodiscard]] Iterator begin() noexcept { return Iterator(head_.next_node); }
-  // Возвращает итератор, указывающий на позицию, следующую за последним
-  // элементом односвязного списка Разыменовывать этот итератор нельзя — попытка
-  // разыменования приведёт к неопределённому поведению
-  [[nodiscard]] Iterator end() noexcept {
-    Iterator it(&head_);
-    while (it.node_->next_node != nullptr) {
-      ++it;
-    }
-    return ++it;
-  }
-
-  // Возвращает константный итератор, ссылающийся на первый элемент
-  // Если список пустой, возвращённый итератор будет равен end()
-  // Результат вызова эквивалентен вызову метода cbegin()
-  [[nodiscard]] ConstIterator begin() const noexcept {
-    return ConstIterator(head_.next_node);
-  }
-
-  // Возвращает константный итератор, указывающий на позицию, следующую за
-  // последним элементом односвязного списка Разыменовывать этот итератор нельзя
-  // — попытка разыменования приведёт к неопределённому поведению Результат
-  // вызова эквивалентен вызову метода cend()
-  [[nodiscard]] ConstIterator end() const noexcept {
-    return ConstIterator(nullptr);
-  }
-
-  // Возвращает константный итератор, ссылающийся на первый элемент
-  // Если список пустой, возвращённый итератор будет равен cend()
-  [[nodiscard]] ConstIterator cbegin() const noexcept {
-    return ConstIterator(head_.next_node);
-  }
-
-  // Возвращает константный итератор, указывающий на позицию, следующую за
-  // последним элементом односвязного списка Разыменовывать этот итератор нельзя
-  // — попытка разыменования приведёт к неопределённому поведению
-  [[nodiscard]] ConstIterator cend() const noexcept { return this->end(); }
-
-  SingleLinkedList() {
-    head_.next_node = nullptr;
-    size_ = 0;
-  }
-
-  // Возвращает количество элементов в списке
-  [[nodiscard]] size_t GetSize() const noexcept { return size_; }
-
-  // Сообщает, пустой ли список
-  [[nodiscard]] bool IsEmpty() const noexcept {
-    return head_.next_node == nullptr;
-  }
-
-  // Вставляет элемент value в начало списка за время O(1)
-  void PushFront(const Type &value) {
-    head_.next_node = new Node(value, head_.next_node);
-    size_++;
-  }
-
-  // Очищает список за время O(N)
-  void Clear() noexcept {
-    while (head_.next_node != nullptr) {
-      Node *target = head_.next_node;
-      head_.next_node = target->next_node;
-      delete target;
-      size_--;
-    }
-  }
-
-  ~SingleLinkedList() { Clear(); }
-
-  SingleLinkedList(std::initializer_list<Type> values) {
-    size_ = 0;
-    auto it = values.end();
-    do {
-      it--;
-      head_.next_node = new Node(*it, head_.next_node);
-      size_++;
-
-    } while (it != values.begin());
-  }
-
-  SingleLinkedList(const SingleLinkedList &other) {
-    size_ = 0;
-    try {
-      SingleLinkedList tmp;
-      auto other_it = other.begin();
-      while (other_it != other.end()) {
-        tmp.PushFront(*other_it);
-        ++other_it;
-      }
-      auto tmp_it = tmp.begin();
-      while (tmp_it != tmp.end()) {
-        PushFront(*tmp_it);
-        ++tmp_it;
-      }
-    } catch (const std::exception &e) {
-      Clear();
-      throw;
-    }
-  }
-
-  void swap(SingleLinkedList &other) noexcept {
-    std::swap(head_.next_node, other.head_.next_node);
-    std::swap(size_, other.size_);
-  }
-
-  SingleLinkedList &operator=(const SingleLinkedList &rhs) {
-    try {
-      SingleLinkedList tmp(rhs);
-      swap(tmp);
-    } catch (const std::exception &e) {
-      throw;
-    }
-
-    return *this;
-  }
-
-  // Возвращает итератор, указывающий на позицию перед первым элементом
-  // односвязного списка.
-  // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к
-  // неопределённому поведению
-  [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
-
-  // Возвращает константный итератор, указывающий на позицию перед первым
-  // элементом односвязного списка. Разыменовывать этот итератор нельзя -
-  // попытка разыменования приведёт к неопределённому поведению
-  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-    return ConstIterator(const_cast<Node *>(&head_));
-  }
-
-  // Возвращает константный итератор, указывающий на позицию перед первым
-  // элементом односвязного списка. Разыменовывать этот итератор нельзя -
-  // попытка разыменования приведёт к неопределённому поведению
-  [[nodiscard]] ConstIterator before_begin() const noexcept {
-    return ConstIterator(cbefore_begin());
-  }
-
-  /*
-   * Вставляет элемент value после элемента, на который указывает pos.
-   * Возвращает итератор на вставленный элемент
-   * Если при создании элемента будет выброшено исключение, список останется в
-   * прежнем состоянии
-   */
-  Iterator InsertAfter(ConstIterator pos, const Type &value) {
-    Node *new_node = new Node(value, pos.node_->next_node);
-    pos.node_->next_node = new_node;
-    size_++;
-    return Iterator(new_node);
-  }
-
-  void PopFront() noexcept {
-    Node *target = head_.next_node;
-    head_.next_node = target->next_node;
-    delete target;
-    size_--;
-  }
-
-  /*
-   * Удаляет элемент, следующий за pos.
-   * Возвращает итератор на элемент, следующий за удалённым
-   */
-  Iterator EraseAfter(ConstIterator pos) noexcept {
-    Node *target = pos.node_->next_node;
-    pos.node_->next_node = target->next_node;
-    delete target;
-    size_--;
-    return Iterator(pos.node_->next_node);
-  }
-
- private:
-  // Фиктивный узел, используется для вставки "перед первым элементом"
-  Node head_;
-  size_t size_;
-};
-
-template <typename Type>
-void swap(SingleLinkedList<Type> &lhs, SingleLinkedList<Type> &rhs) noexcept {
-  lhs.swap(rhs);
-}
-
-template <typename Type>
-bool operator==(const SingleLinkedList<Type> &lhs,
-                const SingleLinkedList<Type> &rhs) {
-  bool result = true;
-  if (lhs.GetSize() != rhs.GetSize()) {
-    return false;
-  }
-  auto lhs_it = lhs.begin();
-  auto rhs_it = rhs.begin();
-  while (lhs_it != lhs.end()) {
-    if (*lhs_it != *rhs_it) {
-      result = false;
-      break;
-    }
-    ++lhs_it;
-    ++rhs_it;
-  }
-  return result;
-}
-
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type> &lhs,
-                const SingleLinkedList<Type> &rhs) {
-  return !(lhs == rhs);
-}
-
-template <typename Type>
-bool operator<(const SingleLinkedList<Type> &lhs,
-               const SingleLinkedList<Type> &rhs) {
-  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
-                                      rhs.end());
-}
-
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type> &lhs,
-                const SingleLinkedList<Type> &rhs) {
-  return (lhs == rhs || lhs < rhs);
-}
-
-template <typename Type>
-bool operator>(const SingleLinkedList<Type> &lhs,
-               const SingleLinkedList<Type> &rhs) {
-  return !(lhs <= rhs);
-}
-
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type> &lhs,
-                const SingleLinkedList<Type> &rhs) {
-  return (lhs > rhs || lhs == rhs);
-}
+#include "arena_single_linked_list.h"
+#include "batching_queue.h"
+#include "concurrent_single_linked_list.h"
+#include "fingerprinted_single_linked_list.h"
+#include "indexed_single_linked_list.h"
+#include "list_reclaimer.h"
+#include "list_serialization.h"
+#include "lock_coupling_single_linked_list.h"
+#include "mapped_single_linked_list.h"
+#include "node_pool_resource.h"
+#include "parallel_algorithms.h"
+#include "persistent_single_linked_list.h"
+#include "positional_single_linked_list.h"
+#include "simd_kernels.h"
+#include "single_linked_list.h"
+#include "small_single_linked_list.h"
+#include "static_single_linked_list.h"
+#include "unrolled_single_linked_list.h"
 
 void Test0() {
   using namespace std;
@@ -918,10 +602,2945 @@ void Test4() {
   }
 }
 
+void Test5() {
+  // end() неконстантного списка совпадает с end() константного
+  {
+    SingleLinkedList<int> list{1, 2, 3};
+    const auto &const_list = list;
+    assert(list.end() == const_list.end());
+    assert(list.end() == list.cend());
+
+    auto it = list.begin();
+    ++it;
+    ++it;
+    assert(++it == list.end());
+  }
+
+  // Вставка в конец списка
+  {
+    SingleLinkedList<int> list;
+    list.PushBack(1);
+    list.PushBack(2);
+    list.PushFront(0);
+    list.PushBack(3);
+    assert((list == SingleLinkedList<int>{0, 1, 2, 3}));
+    assert(list.GetSize() == 4u);
+  }
+
+  // Хвост остаётся корректным после удаления и вставки в произвольные позиции
+  {
+    SingleLinkedList<int> list{1, 2};
+    list.EraseAfter(list.cbegin());
+    list.PushBack(3);
+    assert((list == SingleLinkedList<int>{1, 3}));
+
+    list.PopFront();
+    list.PopFront();
+    assert(list.IsEmpty());
+    list.PushBack(4);
+    assert((list == SingleLinkedList<int>{4}));
+
+    list.InsertAfter(list.cbegin(), 5);
+    list.PushBack(6);
+    assert((list == SingleLinkedList<int>{4, 5, 6}));
+
+    list.Clear();
+    list.PushBack(7);
+    assert((list == SingleLinkedList<int>{7}));
+  }
+
+  // Хвост корректно переходит при обмене, в том числе с пустым списком
+  {
+    SingleLinkedList<int> first{1, 2};
+    SingleLinkedList<int> second;
+    first.swap(second);
+    first.PushBack(10);
+    second.PushBack(3);
+    assert((first == SingleLinkedList<int>{10}));
+    assert((second == SingleLinkedList<int>{1, 2, 3}));
+  }
+
+  // Инициализация пустым std::initializer_list
+  {
+    SingleLinkedList<int> list{std::initializer_list<int>{}};
+    assert(list.IsEmpty());
+  }
+}
+
+void Test6() {
+  using namespace std;
+
+  // Перемещающий конструктор забирает узлы, не копируя их
+  {
+    SingleLinkedList<string> source{"a"s, "b"s, "c"s};
+    const auto old_begin = source.begin();
+    SingleLinkedList<string> moved(std::move(source));
+    assert(moved.begin() == old_begin);
+    assert(moved.GetSize() == 3u);
+    assert(source.IsEmpty());
+    assert(source.GetSize() == 0u);
+
+    // Перемещённый список остаётся пригодным к использованию
+    source.PushBack("d"s);
+    assert((source == SingleLinkedList<string>{"d"s}));
+  }
+
+  // Перемещающее присваивание
+  {
+    SingleLinkedList<string> source{"a"s, "b"s};
+    SingleLinkedList<string> receiver{"x"s, "y"s, "z"s};
+    const auto old_begin = source.begin();
+    receiver = std::move(source);
+    assert(receiver.begin() == old_begin);
+    assert((receiver == SingleLinkedList<string>{"a"s, "b"s}));
+    assert(source.IsEmpty());
+
+    receiver.PushBack("c"s);
+    assert((receiver == SingleLinkedList<string>{"a"s, "b"s, "c"s}));
+  }
+
+  // Вставка перемещением и конструирование на месте для некопируемых типов
+  {
+    SingleLinkedList<unique_ptr<int>> list;
+    list.PushFront(make_unique<int>(2));
+    list.EmplaceFront(new int(1));
+    list.PushBack(make_unique<int>(4));
+    list.InsertAfter(++list.cbegin(), make_unique<int>(3));
+    auto inserted = list.EmplaceAfter(list.cbefore_begin(), new int(0));
+    assert(inserted == list.begin());
+    assert(list.GetSize() == 5u);
+
+    int expected = 0;
+    for (const auto &ptr : list) {
+      assert(*ptr == expected++);
+    }
+  }
+
+  // Конструирование на месте из нескольких аргументов
+  {
+    SingleLinkedList<string> list;
+    auto &front = list.EmplaceFront(3u, 'x');
+    assert(front == "xxx"s);
+    auto &back = list.EmplaceBack("abcdef", 2u);
+    assert(back == "ab"s);
+    assert((list == SingleLinkedList<string>{"xxx"s, "ab"s}));
+  }
+}
+
+void Test7() {
+  using namespace std;
+
+  // Копирование сохраняет порядок элементов
+  {
+    const SingleLinkedList<int> source{1, 2, 3, 4, 5};
+    SingleLinkedList<int> copy(source);
+    assert(copy == source);
+    copy.PushBack(6);
+    assert((copy == SingleLinkedList<int>{1, 2, 3, 4, 5, 6}));
+  }
+
+  // Присваивание переиспользует узлы приёмника
+  {
+    const SingleLinkedList<int> source{1, 2, 3};
+
+    SingleLinkedList<int> same_size{7, 8, 9};
+    const auto old_begin = same_size.begin();
+    same_size = source;
+    assert(same_size.begin() == old_begin);
+    assert(same_size == source);
+
+    SingleLinkedList<int> longer{5, 6, 7, 8, 9};
+    const auto longer_begin = longer.begin();
+    longer = source;
+    assert(longer.begin() == longer_begin);
+    assert(longer == source);
+    longer.PushBack(4);
+    assert((longer == SingleLinkedList<int>{1, 2, 3, 4}));
+
+    SingleLinkedList<int> shorter{9};
+    const auto shorter_begin = shorter.begin();
+    shorter = source;
+    assert(shorter.begin() == shorter_begin);
+    assert(shorter == source);
+    shorter.PushBack(4);
+    assert((shorter == SingleLinkedList<int>{1, 2, 3, 4}));
+
+    SingleLinkedList<int> empty;
+    empty = source;
+    assert(empty == source);
+
+    shorter = SingleLinkedList<int>{};
+    assert(shorter.IsEmpty());
+    shorter.PushBack(1);
+    assert((shorter == SingleLinkedList<int>{1}));
+  }
+
+  // Явное присваивание с переиспользованием узлов для типов, присваивание
+  // которых может выбросить исключение
+  {
+    const SingleLinkedList<string> source{"one"s, "two"s, "three"s};
+    SingleLinkedList<string> receiver{"a"s, "b"s};
+    const auto old_begin = receiver.begin();
+    receiver.AssignReusingNodes(source);
+    assert(receiver.begin() == old_begin);
+    assert(receiver == source);
+
+    // Самоприсваивание не меняет список
+    receiver.AssignReusingNodes(receiver);
+    assert(receiver == source);
+    const auto &self = receiver;
+    receiver = self;
+    assert(receiver == source);
+  }
+}
+
+// Аллокатор, подсчитывающий выделения и освобождения памяти
+template <typename Type>
+struct CountingAllocator {
+  using value_type = Type;
+
+  CountingAllocator(int *allocations, int *deallocations) noexcept
+      : allocations_ptr(allocations), deallocations_ptr(deallocations) {}
+
+  template <typename Other>
+  CountingAllocator(const CountingAllocator<Other> &other) noexcept
+      : allocations_ptr(other.allocations_ptr),
+        deallocations_ptr(other.deallocations_ptr) {}
+
+  Type *allocate(size_t n) {
+    ++(*allocations_ptr);
+    return std::allocator<Type>().allocate(n);
+  }
+
+  void deallocate(Type *p, size_t n) noexcept {
+    ++(*deallocations_ptr);
+    std::allocator<Type>().deallocate(p, n);
+  }
+
+  int *allocations_ptr = nullptr;
+  int *deallocations_ptr = nullptr;
+};
+
+template <typename Lhs, typename Rhs>
+bool operator==(const CountingAllocator<Lhs> &lhs,
+                const CountingAllocator<Rhs> &rhs) noexcept {
+  return lhs.allocations_ptr == rhs.allocations_ptr;
+}
+
+template <typename Lhs, typename Rhs>
+bool operator!=(const CountingAllocator<Lhs> &lhs,
+                const CountingAllocator<Rhs> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+void Test8() {
+  using namespace std;
+
+  struct AllocationStats {
+    int allocations = 0;
+    int deallocations = 0;
+  };
+
+  // Проверка размещения узлов пользовательским аллокатором
+  AllocationStats stats;
+  {
+    SingleLinkedList<int, CountingAllocator<int>> list{
+        {1, 2, 3}, CountingAllocator<int>(&stats.allocations,
+                                          &stats.deallocations)};
+    assert(stats.allocations == 3);
+    list.PushFront(0);
+    list.InsertAfter(list.cbegin(), 10);
+    list.PopFront();
+    list.EraseAfter(list.cbegin());
+    assert((list == SingleLinkedList<int, CountingAllocator<int>>{
+                        {10, 2, 3}, list.get_allocator()}));
+
+    // Копия получает аллокатор источника
+    auto copy(list);
+    assert(copy.get_allocator() == list.get_allocator());
+    copy = list;
+    copy.Clear();
+  }
+  assert(stats.allocations == stats.deallocations);
+  assert(stats.allocations > 0);
+
+  // Пул узлов переиспользует освобождённые ячейки
+  {
+    NodePoolResource pool(4);
+    ::pmr::SingleLinkedList<int> list(&pool);
+    list.PushFront(1);
+    const int *first_address = &*list.begin();
+    list.PopFront();
+    list.PushFront(2);
+    assert(&*list.begin() == first_address);
+
+    for (int i = 0; i < 8; ++i) {
+      list.PushBack(i);
+    }
+    assert(pool.GetBlockCount() == 3u);
+    list.Clear();
+    for (int i = 0; i < 9; ++i) {
+      list.PushBack(i);
+    }
+    assert(pool.GetBlockCount() == 3u);
+    assert(list.GetSize() == 9u);
+  }
+
+  // Перемещение между списками с разными ресурсами перемещает элементы
+  {
+    NodePoolResource first_pool;
+    NodePoolResource second_pool;
+    ::pmr::SingleLinkedList<string> source({"a"s, "b"s}, &first_pool);
+    ::pmr::SingleLinkedList<string> receiver(&second_pool);
+    receiver = std::move(source);
+    assert((receiver == ::pmr::SingleLinkedList<string>{"a"s, "b"s}));
+    assert(source.IsEmpty());
+    assert(receiver.get_allocator().resource() == &second_pool);
+
+    ::pmr::SingleLinkedList<string> same_pool(&second_pool);
+    const auto old_begin = receiver.begin();
+    same_pool = std::move(receiver);
+    assert(same_pool.begin() == old_begin);
+
+    // Копия pmr-списка использует ресурс по умолчанию
+    ::pmr::SingleLinkedList<string> copy(same_pool);
+    assert(copy.get_allocator().resource() ==
+           std::pmr::get_default_resource());
+    assert(copy == same_pool);
+  }
+}
+
+void Test9() {
+  using namespace std;
+  using IntList = UnrolledSingleLinkedList<int, 4>;
+
+  // Вставка в начало и в конец заполняет узлы целиком
+  {
+    IntList list;
+    assert(list.IsEmpty());
+    assert(list.begin() == list.end());
+    assert(++list.before_begin() == list.begin());
+    for (int i = 5; i < 10; ++i) {
+      list.PushBack(i);
+    }
+    for (int i = 4; i >= 0; --i) {
+      list.PushFront(i);
+    }
+    assert(list.GetSize() == 10u);
+    int expected = 0;
+    for (int value : list) {
+      assert(value == expected++);
+    }
+    assert((list == IntList{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  }
+
+  // Вставка в середину заполненного узла делит его
+  {
+    IntList list{1, 2, 3, 4};
+    auto pos = list.cbegin();
+    ++pos;
+    auto inserted = list.InsertAfter(pos, 10);
+    assert(*inserted == 10);
+    assert((list == IntList{1, 2, 10, 3, 4}));
+
+    inserted = list.InsertAfter(list.cbefore_begin(), 0);
+    assert(inserted == list.begin());
+    inserted = list.InsertAfter(inserted, 20);
+    assert(*inserted == 20);
+    assert((list == IntList{0, 20, 1, 2, 10, 3, 4}));
+
+    // Вставка после последнего элемента продолжает оставаться O(1)
+    auto last = list.cbegin();
+    for (size_t i = 1; i < list.GetSize(); ++i) {
+      ++last;
+    }
+    list.InsertAfter(last, 5);
+    list.PushBack(6);
+    assert((list == IntList{0, 20, 1, 2, 10, 3, 4, 5, 6}));
+    assert(list.GetSize() == 9u);
+  }
+
+  // Удаление элементов, в том числе опустошающее узлы
+  {
+    IntList list{1, 2, 3, 4, 5, 6};
+    auto after = list.EraseAfter(list.cbegin());
+    assert(*after == 3);
+    assert((list == IntList{1, 3, 4, 5, 6}));
+
+    // Удаление последних элементов списка
+    auto pos = list.cbegin();
+    ++pos;
+    ++pos;
+    after = list.EraseAfter(pos);
+    assert(*after == 6);
+    after = list.EraseAfter(pos);
+    assert(after == list.end());
+    assert((list == IntList{1, 3, 4}));
+    list.PushBack(7);
+    assert((list == IntList{1, 3, 4, 7}));
+
+    while (!list.IsEmpty()) {
+      list.PopFront();
+    }
+    assert(list.begin() == list.end());
+    list.PushBack(1);
+    assert((list == IntList{1}));
+  }
+
+  // Удаление элемента, который единственный в своём узле
+  {
+    IntList list{1, 2, 3, 4};
+    list.PushBack(5);
+    auto pos = list.cbegin();
+    for (int i = 0; i < 3; ++i) {
+      ++pos;
+    }
+    auto after = list.EraseAfter(pos);
+    assert(after == list.end());
+    list.PushBack(6);
+    assert((list == IntList{1, 2, 3, 4, 6}));
+  }
+
+  // Элементы с нетривиальным деструктором разрушаются
+  {
+    auto counter = make_shared<int>(0);
+    {
+      UnrolledSingleLinkedList<shared_ptr<int>, 2> list;
+      for (int i = 0; i < 5; ++i) {
+        list.PushFront(counter);
+      }
+      list.InsertAfter(list.cbegin(), counter);
+      list.EraseAfter(list.cbegin());
+      assert(counter.use_count() == 6);
+      auto copy(list);
+      assert(counter.use_count() == 11);
+      copy.Clear();
+      assert(counter.use_count() == 6);
+    }
+    assert(counter.use_count() == 1);
+  }
+
+  // Копирование, перемещение, обмен и сравнение
+  {
+    const IntList source{1, 2, 3, 4, 5};
+    IntList copy(source);
+    assert(copy == source);
+    IntList receiver{9};
+    receiver = source;
+    assert(receiver == source);
+
+    IntList moved(std::move(copy));
+    assert(moved == source);
+    assert(copy.IsEmpty());
+
+    IntList other{7, 8};
+    const auto old_begin = other.begin();
+    moved.swap(other);
+    assert(moved.begin() == old_begin);
+    assert((other == IntList{1, 2, 3, 4, 5}));
+
+    assert((IntList{1, 2, 3} < IntList{1, 2, 3, 1}));
+    assert((IntList{1, 2, 3} <= IntList{1, 2, 3}));
+    assert((IntList{1, 2, 4} > IntList{1, 2, 3}));
+    assert((IntList{1, 2, 3} >= IntList{1, 2, 3}));
+    assert((IntList{1, 2, 3} != IntList{1, 2}));
+  }
+
+  // Присваивание списков с полиморфными аллокаторами: аллокатор не
+  // распространяется, и узлы размещаются ресурсом получателя
+  {
+    using PmrList = UnrolledSingleLinkedList<
+        int, 4, std::pmr::polymorphic_allocator<int>>;
+    std::pmr::monotonic_buffer_resource shared;
+    std::pmr::monotonic_buffer_resource other_resource;
+    const PmrList source({1, 2, 3, 4, 5}, &shared);
+    PmrList same({9}, &shared);
+    same = source;
+    assert(same == source);
+    PmrList foreign({9}, &other_resource);
+    foreign = source;
+    assert(foreign == source);
+    assert(foreign.get_allocator().resource() == &other_resource);
+
+    foreign = PmrList({6, 7}, &shared);
+    assert((foreign == PmrList({6, 7}, &shared)));
+    assert(foreign.get_allocator().resource() == &other_resource);
+    same = PmrList({8}, &shared);
+    assert((same == PmrList({8}, &shared)));
+  }
+
+  // Обход по непрерывным фрагментам
+  {
+    const IntList list{1, 2, 3, 4, 5, 6};
+    size_t chunks = 0;
+    int sum = 0;
+    list.ForEachChunk([&](const int *values, size_t count) {
+      ++chunks;
+      for (size_t i = 0; i < count; ++i) {
+        sum += values[i];
+      }
+    });
+    assert(chunks == 2u);
+    assert(sum == 21);
+  }
+}
+
+void Test10() {
+  // Элемент, подсчитывающий выполненные над ним сравнения
+  struct CountedInt {
+    bool operator==(const CountedInt &rhs) const {
+      ++(*counter);
+      return value == rhs.value;
+    }
+    bool operator!=(const CountedInt &rhs) const { return !(*this == rhs); }
+    bool operator<(const CountedInt &rhs) const {
+      ++(*counter);
+      return value < rhs.value;
+    }
+    int value;
+    int *counter;
+  };
+
+  // Каждый оператор сравнения проходит списки не более одного раза
+  {
+    int counter = 0;
+    SingleLinkedList<CountedInt> lhs;
+    SingleLinkedList<CountedInt> rhs;
+    for (int i = 0; i < 10; ++i) {
+      lhs.PushBack({i, &counter});
+      rhs.PushBack({i, &counter});
+    }
+    assert(lhs >= rhs);
+    assert(lhs <= rhs);
+    assert(!(lhs > rhs));
+    assert(!(lhs < rhs));
+    assert(counter == 40);
+
+    counter = 0;
+    rhs.PushBack({0, &counter});
+    assert(lhs < rhs);
+    assert(rhs >= lhs);
+    assert(counter == 20);
+  }
+
+  // Сравнение элементов, которые эквивалентны, но не равны
+  {
+    struct Loose {
+      bool operator==(const Loose &) const { return false; }
+      bool operator!=(const Loose &) const { return true; }
+      bool operator<(const Loose &) const { return false; }
+    };
+    SingleLinkedList<Loose> lhs{Loose{}};
+    SingleLinkedList<Loose> rhs{Loose{}};
+    assert(!(lhs < rhs));
+    assert(!(lhs <= rhs));
+    assert(lhs > rhs);
+    assert(lhs >= rhs);
+  }
+
+  // Сравнение развёрнутых списков с разным разбиением на узлы
+  {
+    using IntList = UnrolledSingleLinkedList<int, 4>;
+    IntList lhs{1, 2, 3, 4, 5, 6, 7};
+    IntList rhs;
+    for (int i = 7; i >= 1; --i) {
+      rhs.PushFront(i);
+    }
+    rhs.InsertAfter(rhs.cbegin(), 100);
+    rhs.EraseAfter(rhs.cbegin());
+    assert(lhs == rhs);
+    assert(lhs <= rhs && lhs >= rhs);
+    assert(!(lhs < rhs) && !(lhs > rhs));
+
+    rhs.PushBack(8);
+    assert(lhs != rhs);
+    assert(lhs < rhs);
+    assert(rhs > lhs);
+
+    IntList bigger{1, 2, 3, 5};
+    assert(lhs < bigger);
+    assert(bigger >= lhs);
+
+    using DoubleList = UnrolledSingleLinkedList<double, 4>;
+    assert((DoubleList{0.0, 1.5} == DoubleList{-0.0, 1.5}));
+    assert((DoubleList{1.0, 2.0} < DoubleList{1.0, 2.5}));
+  }
+
+  // Равенство элементов-классов определяется их operator==, а не байтовым
+  // представлением
+  {
+    struct Key {
+      bool operator==(const Key &rhs) const { return id == rhs.id; }
+      bool operator<(const Key &rhs) const { return id < rhs.id; }
+      int id;
+      int payload;
+    };
+    using KeyList = UnrolledSingleLinkedList<Key, 4>;
+    assert((KeyList{{1, 10}, {2, 30}} == KeyList{{1, 20}, {2, 40}}));
+    assert((KeyList{{1, 10}} != KeyList{{2, 10}}));
+
+    enum class Color { kRed, kGreen };
+    using ColorList = UnrolledSingleLinkedList<Color, 4>;
+    assert((ColorList{Color::kRed, Color::kGreen} ==
+            ColorList{Color::kRed, Color::kGreen}));
+    assert((ColorList{Color::kRed} != ColorList{Color::kGreen}));
+  }
+}
+
+void Test11() {
+  using namespace std;
+
+  // Создание списка из диапазона итераторов
+  {
+    const vector<int> values{1, 2, 3, 4};
+    SingleLinkedList<int> list(values.begin(), values.end());
+    assert((list == SingleLinkedList<int>{1, 2, 3, 4}));
+    assert(list.GetCapacity() == 4u);
+
+    SingleLinkedList<int> empty(values.end(), values.end());
+    assert(empty.IsEmpty());
+
+    istringstream input("5 6 7");
+    SingleLinkedList<int> from_stream{istream_iterator<int>(input),
+                                      istream_iterator<int>()};
+    assert((from_stream == SingleLinkedList<int>{5, 6, 7}));
+  }
+
+  // Добавление диапазона в конец и присваивание диапазона
+  {
+    SingleLinkedList<int> list{1, 2};
+    const vector<int> tail{3, 4, 5};
+    list.AppendRange(tail.begin(), tail.end());
+    assert((list == SingleLinkedList<int>{1, 2, 3, 4, 5}));
+    list.PushBack(6);
+    assert(list.GetSize() == 6u);
+
+    const auto old_begin = list.begin();
+    list.Assign({10, 20});
+    assert(list.begin() == old_begin);
+    assert((list == SingleLinkedList<int>{10, 20}));
+    list.PushBack(30);
+    assert((list == SingleLinkedList<int>{10, 20, 30}));
+
+    list.Assign(tail.begin(), tail.end());
+    list.Assign({7, 8, 9, 10, 11});
+    assert((list == SingleLinkedList<int>{7, 8, 9, 10, 11}));
+  }
+
+  // Исключение при добавлении диапазона оставляет список прежним
+  {
+    struct ThrowOnCopy {
+      ThrowOnCopy() = default;
+      explicit ThrowOnCopy(int &copy_counter) noexcept
+          : countdown_ptr(&copy_counter) {}
+      ThrowOnCopy(const ThrowOnCopy &other)
+          : countdown_ptr(other.countdown_ptr)  //
+      {
+        if (countdown_ptr) {
+          if (*countdown_ptr == 0) {
+            throw std::bad_alloc();
+          } else {
+            --(*countdown_ptr);
+          }
+        }
+      }
+      ThrowOnCopy &operator=(const ThrowOnCopy &rhs) = delete;
+      int *countdown_ptr = nullptr;
+    };
+
+    int copy_counter = 2;
+    vector<ThrowOnCopy> values(4, ThrowOnCopy{});
+    for (auto &value : values) {
+      value.countdown_ptr = &copy_counter;
+    }
+    SingleLinkedList<ThrowOnCopy> list;
+    list.PushBack(ThrowOnCopy{});
+    try {
+      list.AppendRange(values.begin(), values.end());
+      assert(false);
+    } catch (const bad_alloc &) {
+      assert(list.GetSize() == 1u);
+      assert(list.begin()->countdown_ptr == nullptr);
+    }
+  }
+
+  // Зарезервированные узлы используются без обращения к аллокатору
+  {
+    int allocations = 0;
+    int deallocations = 0;
+    {
+      SingleLinkedList<int, CountingAllocator<int>> list{
+          CountingAllocator<int>(&allocations, &deallocations)};
+      list.Reserve(5);
+      assert(allocations == 5);
+      assert(list.GetCapacity() == 5u);
+      assert(list.IsEmpty());
+      for (int i = 0; i < 5; ++i) {
+        list.PushFront(i);
+      }
+      list.InsertAfter(list.cbegin(), 10);
+      assert(allocations == 6);
+
+      list.Reserve(10);
+      assert(list.GetCapacity() == 10u);
+      const vector<int> values{1, 2, 3, 4};
+      list.AppendRange(values.begin(), values.end());
+      assert(allocations == 10);
+      assert(list.GetSize() == 10u);
+
+      list.Clear();
+      list.Reserve(3);
+      list.ShrinkToFit();
+      assert(allocations == deallocations);
+      list.Reserve(2);
+    }
+    assert(allocations == deallocations);
+  }
+}
+
+void Test12() {
+  using IntList = SingleLinkedList<int>;
+
+  // Перенос всех элементов другого списка
+  {
+    IntList list{1, 5};
+    IntList other{2, 3, 4};
+    const auto other_begin = other.cbegin();
+    list.SpliceAfter(list.cbegin(), other);
+    assert((list == IntList{1, 2, 3, 4, 5}));
+    assert(other.IsEmpty());
+    assert(++list.cbegin() == other_begin);
+
+    IntList tail{6, 7};
+    auto last = list.cbegin();
+    for (size_t i = 1; i < list.GetSize(); ++i) {
+      ++last;
+    }
+    list.SpliceAfter(last, std::move(tail));
+    list.PushBack(8);
+    assert((list == IntList{1, 2, 3, 4, 5, 6, 7, 8}));
+    assert(list.GetSize() == 8u);
+
+    other.PushBack(0);
+    list.SpliceAfter(list.cbefore_begin(), other);
+    assert(list.GetSize() == 9u);
+    assert(*list.begin() == 0);
+    other.PushBack(1);
+    assert(other.GetSize() == 1u);
+  }
+
+  // Перенос интервала и отдельного элемента
+  {
+    IntList list{1, 2};
+    IntList other{10, 20, 30, 40};
+    auto first = other.cbegin();
+    auto last = first;
+    ++last;
+    ++last;
+    ++last;
+    // Переносятся элементы 20 и 30
+    list.SpliceAfter(list.cbegin(), other, first, last);
+    assert((list == IntList{1, 20, 30, 2}));
+    assert((other == IntList{10, 40}));
+    assert(other.GetSize() == 2u);
+
+    // Перенос последнего элемента другого списка обновляет его хвост
+    list.SpliceAfter(list.cbefore_begin(), other, other.cbegin());
+    assert((list == IntList{40, 1, 20, 30, 2}));
+    other.PushBack(50);
+    assert((other == IntList{10, 50}));
+    list.PushBack(3);
+    assert((list == IntList{40, 1, 20, 30, 2, 3}));
+
+    // Перенос внутри одного списка: первый элемент становится последним
+    auto tail = list.cbegin();
+    for (size_t i = 1; i < list.GetSize(); ++i) {
+      ++tail;
+    }
+    list.SpliceAfter(tail, list, list.cbefore_begin());
+    assert((list == IntList{1, 20, 30, 2, 3, 40}));
+    list.PushBack(4);
+    assert((list == IntList{1, 20, 30, 2, 3, 40, 4}));
+
+    // Перенос элемента на его же место не изменяет список
+    IntList same{1, 2, 3};
+    same.SpliceAfter(same.cbegin(), same, same.cbefore_begin());
+    same.SpliceAfter(same.cbefore_begin(), same, same.cbefore_begin());
+    same.SpliceAfter(std::next(same.cbegin()), same, same.cbegin());
+    assert((same == IntList{1, 2, 3}));
+    assert(same.GetSize() == 3u);
+    same.PushBack(4);
+    assert((same == IntList{1, 2, 3, 4}));
+  }
+
+  // Слияние отсортированных списков
+  {
+    IntList list{1, 3, 5, 7};
+    IntList other{0, 2, 3, 8, 9};
+    list.Merge(other);
+    assert((list == IntList{0, 1, 2, 3, 3, 5, 7, 8, 9}));
+    assert(list.GetSize() == 9u);
+    assert(other.IsEmpty());
+    list.PushBack(10);
+    assert(list.GetSize() == 10u);
+
+    IntList empty;
+    empty.Merge(IntList{1, 2});
+    empty.PushBack(3);
+    assert((empty == IntList{1, 2, 3}));
+
+    IntList descending{5, 3, 1};
+    descending.Merge(IntList{6, 4}, std::greater<>());
+    assert((descending == IntList{6, 5, 4, 3, 1}));
+  }
+
+  // Устойчивая сортировка перецепляет узлы
+  {
+    IntList list{5, 1, 4, 2, 8, 7, 3, 6, 0, 9};
+    const int *five = &*list.begin();
+    list.Sort();
+    assert((list == IntList{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    assert(&*std::next(list.begin(), 5) == five);
+    list.PushBack(10);
+    assert(list.GetSize() == 11u);
+
+    list.Sort(std::greater<>());
+    assert(*list.begin() == 10);
+    list.PushBack(-1);
+    auto it = list.cbegin();
+    for (int expected = 10; expected >= -1; --expected, ++it) {
+      assert(*it == expected);
+    }
+
+    struct Record {
+      int key;
+      int order;
+    };
+    SingleLinkedList<Record> records{{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}};
+    records.Sort([](const Record &lhs, const Record &rhs) {
+      return lhs.key < rhs.key;
+    });
+    const int expected_order[] = {4, 1, 3, 0, 2};
+    int i = 0;
+    for (const Record &record : records) {
+      assert(record.order == expected_order[i++]);
+    }
+
+    IntList single{1};
+    single.Sort();
+    single.PushBack(2);
+    assert((single == IntList{1, 2}));
+  }
+
+  // Исключение в сравнении оставляет все элементы в списке
+  {
+    auto make_throwing_less = [](int limit) {
+      return [limit, calls = 0](int lhs, int rhs) mutable {
+        if (++calls > limit) {
+          throw std::runtime_error("compare");
+        }
+        return lhs < rhs;
+      };
+    };
+    auto sorted_values = [](const IntList &list) {
+      std::vector<int> values(list.begin(), list.end());
+      std::sort(values.begin(), values.end());
+      return values;
+    };
+
+    for (int limit = 0; limit < 12; ++limit) {
+      IntList list{5, 1, 4, 2, 8, 7, 3};
+      try {
+        list.Sort(make_throwing_less(limit));
+      } catch (const std::runtime_error &) {
+      }
+      assert(list.GetSize() == 7u);
+      assert(static_cast<size_t>(std::distance(list.begin(), list.end())) ==
+             7u);
+      assert((sorted_values(list) == std::vector<int>{1, 2, 3, 4, 5, 7, 8}));
+      list.PushBack(9);
+      assert(*std::next(list.begin(), 7) == 9);
+    }
+
+    for (int limit = 0; limit < 4; ++limit) {
+      IntList list{1, 3, 5};
+      IntList other{0, 2, 4, 6};
+      try {
+        list.Merge(other, make_throwing_less(limit));
+        assert(false);
+      } catch (const std::runtime_error &) {
+      }
+      assert(other.IsEmpty());
+      assert(list.GetSize() == 7u);
+      assert((sorted_values(list) == std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+      list.PushBack(7);
+      assert(*std::next(list.begin(), 7) == 7);
+    }
+  }
+}
+
+void Test13() {
+  using IntList = SingleLinkedList<int>;
+
+  // Удаление интервала элементов
+  {
+    IntList list{1, 2, 3, 4, 5};
+    auto last = list.cbegin();
+    for (int i = 0; i < 3; ++i) {
+      ++last;
+    }
+    assert(list.EraseAfter(list.cbegin(), last) == 2u);
+    assert((list == IntList{1, 4, 5}));
+    assert(list.GetSize() == 3u);
+
+    assert(list.EraseAfter(list.cbegin(), ++list.cbegin()) == 0u);
+    assert(list.EraseAfter(list.cbegin(), list.cend()) == 2u);
+    list.PushBack(6);
+    assert((list == IntList{1, 6}));
+
+    IntList removed;
+    assert(list.EraseAfter(list.cbefore_begin(), list.cend(), removed) == 2u);
+    assert(list.IsEmpty());
+    assert((removed == IntList{1, 6}));
+  }
+
+  // Удаление по условию и по значению
+  {
+    IntList list{1, 2, 3, 4, 5, 6, 7, 8};
+    assert(list.RemoveIf([](int value) { return value % 2 == 0; }) == 4u);
+    assert((list == IntList{1, 3, 5, 7}));
+    list.PushBack(9);
+    assert(list.GetSize() == 5u);
+
+    assert(list.Remove(9) == 1u);
+    assert(list.Remove(100) == 0u);
+    list.PushBack(11);
+    assert((list == IntList{1, 3, 5, 7, 11}));
+
+    // Значение может ссылаться на удаляемый элемент списка
+    list.PushFront(7);
+    assert(list.Remove(*list.begin()) == 2u);
+    assert((list == IntList{1, 3, 5, 11}));
+
+    assert(list.RemoveIf([](int) { return true; }) == 4u);
+    assert(list.IsEmpty());
+    list.PushBack(1);
+    assert((list == IntList{1}));
+  }
+
+  // Отложенное разрушение удалённых элементов
+  {
+    int deleted = 0;
+    struct DeletionSpy {
+      ~DeletionSpy() {
+        if (counter != nullptr) {
+          ++(*counter);
+        }
+      }
+      int id = 0;
+      int *counter = nullptr;
+    };
+    SingleLinkedList<DeletionSpy> list;
+    for (int i = 0; i < 6; ++i) {
+      list.EmplaceBack(DeletionSpy{i, nullptr}).counter = &deleted;
+    }
+    {
+      SingleLinkedList<DeletionSpy> removed;
+      const size_t count = list.RemoveIf(
+          [](const DeletionSpy &spy) { return spy.id < 3; }, removed);
+      assert(count == 3u);
+      assert(deleted == 0);
+      assert(removed.GetSize() == 3u);
+      assert(removed.begin()->id == 0);
+      assert(list.GetSize() == 3u);
+    }
+    assert(deleted == 3);
+  }
+
+  // Удаление повторяющихся подряд элементов
+  {
+    IntList list{1, 1, 2, 2, 2, 3, 1, 1};
+    assert(list.Unique() == 4u);
+    assert((list == IntList{1, 2, 3, 1}));
+    list.PushBack(1);
+    assert(list.Unique() == 1u);
+    list.PushBack(5);
+    assert((list == IntList{1, 2, 3, 1, 5}));
+
+    IntList close{1, 2, 4, 5, 9};
+    IntList removed;
+    const size_t count = close.Unique(
+        [](int lhs, int rhs) { return rhs - lhs == 1; }, removed);
+    assert(count == 2u);
+    assert((close == IntList{1, 4, 9}));
+    assert((removed == IntList{2, 5}));
+
+    IntList empty;
+    assert(empty.Unique() == 0u);
+  }
+}
+
+void Test14() {
+  using namespace std;
+
+  // Однопоточная работа
+  {
+    ConcurrentSingleLinkedList<std::string> list;
+    assert(list.IsEmpty());
+    assert(!list.TryPopFront().has_value());
+
+    list.PushFront("first"s);
+    const std::string second = "second";
+    list.PushFront(second);
+    list.EmplaceFront(3, 'x');
+    assert(list.GetSize() == 3u);
+    assert(!list.IsEmpty());
+
+    assert(list.TryPopFront() == "xxx"s);
+    assert(list.TryPopFront() == "second"s);
+    assert(list.GetSize() == 1u);
+    assert(list.TryPopFront() == "first"s);
+    assert(list.IsEmpty());
+    assert(list.GetSize() == 0u);
+  }
+
+  // Элементы, оставшиеся в списке или ожидающие освобождения, разрушаются
+  // вместе со списком
+  {
+    int allocations = 0;
+    int deallocations = 0;
+    {
+      ConcurrentSingleLinkedList<int, CountingAllocator<int>> list(
+          CountingAllocator<int>(&allocations, &deallocations));
+      for (int i = 0; i < 1000; ++i) {
+        list.PushFront(i);
+      }
+      for (int i = 999; i >= 500; --i) {
+        assert(list.TryPopFront() == i);
+      }
+      assert(list.GetSize() == 500u);
+    }
+    assert(allocations == 1000);
+    assert(deallocations == 1000);
+  }
+
+  // Одновременная работа производителей и потребителей: каждый элемент
+  // извлекается ровно один раз
+  {
+    constexpr int kThreadCount = 4;
+    constexpr int kItemsPerThread = 20000;
+    std::atomic<int> alive{0};
+    struct Item {
+      Item(int item_value, std::atomic<int> *item_alive) noexcept
+          : value(item_value), alive(item_alive) {
+        alive->fetch_add(1);
+      }
+      Item(Item &&other) noexcept : value(other.value), alive(other.alive) {
+        alive->fetch_add(1);
+      }
+      ~Item() { alive->fetch_sub(1); }
+
+      int value;
+      std::atomic<int> *alive;
+    };
+
+    {
+      ConcurrentSingleLinkedList<Item> list;
+      std::atomic<int> popped{0};
+      std::vector<std::atomic<int>> seen(kThreadCount * kItemsPerThread);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&list, &alive, t] {
+          for (int i = 0; i < kItemsPerThread; ++i) {
+            list.EmplaceFront(t * kItemsPerThread + i, &alive);
+          }
+        });
+        threads.emplace_back([&list, &popped, &seen] {
+          while (popped.load() < kThreadCount * kItemsPerThread) {
+            if (auto item = list.TryPopFront()) {
+              seen[item->value].fetch_add(1);
+              popped.fetch_add(1);
+            } else {
+              std::this_thread::yield();
+            }
+          }
+        });
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      assert(list.IsEmpty());
+      assert(list.GetSize() == 0u);
+      assert(std::all_of(seen.begin(), seen.end(),
+                         [](const std::atomic<int> &count) {
+                           return count.load() == 1;
+                         }));
+    }
+    assert(alive.load() == 0);
+  }
+}
+
+void Test15() {
+  using IntList = LockCouplingSingleLinkedList<int>;
+
+  // Однопоточная работа
+  {
+    IntList list{1, 2, 4};
+    assert(list.GetSize() == 3u);
+    assert((std::vector<int>(list.begin(), list.end()) ==
+            std::vector<int>{1, 2, 4}));
+
+    auto it = list.InsertAfter(++list.cbegin(), 3);
+    assert(*it == 3);
+    list.PushFront(0);
+    list.EmplaceFront(-1);
+    assert((std::vector<int>(list.cbegin(), list.cend()) ==
+            std::vector<int>{-1, 0, 1, 2, 3, 4}));
+
+    list.PopFront();
+    assert(list.EraseAfter(list.cbegin()));
+    assert((std::vector<int>(list.begin(), list.end()) ==
+            std::vector<int>{0, 2, 3, 4}));
+    assert(list.GetSize() == 4u);
+
+    assert(list.RemoveIf([](int value) { return value % 2 == 0; }) == 3u);
+    assert((std::vector<int>(list.begin(), list.end()) ==
+            std::vector<int>{3}));
+    list.PopFront();
+    assert(list.IsEmpty());
+    assert(list.begin() == list.end());
+    assert(!list.EraseAfter(list.cbefore_begin()));
+  }
+
+  // Итератор на удалённый элемент остаётся разыменовываемым и продолжает
+  // обход с элемента, следовавшего за удалённым. Вставка после удалённого
+  // элемента не выполняется
+  {
+    IntList list{1, 2, 3};
+    auto second = ++list.begin();
+    assert(list.EraseAfter(list.cbegin()));
+    assert(*second == 2);
+    assert(list.InsertAfter(second, 10) == list.end());
+    assert(!list.EraseAfter(second));
+    ++second;
+    assert(*second == 3);
+    assert(list.GetSize() == 2u);
+  }
+
+  // Длинный список разрушается без рекурсии
+  {
+    IntList list;
+    for (int i = 0; i < 200000; ++i) {
+      list.PushFront(i);
+    }
+  }
+
+  // Потоки одновременно изменяют непересекающиеся участки списка, пока ещё
+  // один поток удаляет из него элементы по условию
+  {
+    constexpr int kThreadCount = 4;
+    constexpr int kOperations = 5000;
+    IntList list;
+    std::vector<IntList::Iterator> markers;
+    for (int t = 0; t < kThreadCount; ++t) {
+      markers.push_back(list.InsertAfter(
+          markers.empty() ? list.cbefore_begin() : markers.back(), -1));
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; ++t) {
+      threads.emplace_back([&list, marker = markers[t]] {
+        for (int i = 0; i < kOperations; ++i) {
+          list.InsertAfter(marker, i);
+          list.InsertAfter(marker, i);
+          list.EraseAfter(marker);
+        }
+      });
+    }
+    threads.emplace_back([&list] {
+      for (int i = 0; i < 20; ++i) {
+        list.RemoveIf([](int value) { return value == 0; });
+      }
+    });
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    list.RemoveIf([](int value) { return value == 0; });
+
+    const std::vector<int> values(list.begin(), list.end());
+    assert(values.size() == list.GetSize());
+    assert(std::count(values.begin(), values.end(), -1) == kThreadCount);
+    assert(values.size() == kThreadCount * kOperations);
+  }
+}
+
+void Test16() {
+  using namespace std;
+
+  // Порог в один элемент заставляет алгоритмы разбивать даже короткие
+  // списки
+  constexpr ParallelPolicy kFourThreads{4, 1};
+
+  SingleLinkedList<int> list;
+  for (int i = 1; i <= 1001; ++i) {
+    list.PushBack(i);
+  }
+
+  // Свёртка
+  {
+    assert(ParallelReduce(kFourThreads, list, 0) == 1001 * 1002 / 2);
+    assert(ParallelReduce(kSequential, list, 10) == 1001 * 1002 / 2 + 10);
+    assert(ParallelReduce(kParallel, SingleLinkedList<int>(), 7) == 7);
+
+    // Некоммутативная операция сохраняет порядок элементов
+    SingleLinkedList<std::string> words;
+    for (char c = 'a'; c <= 'z'; ++c) {
+      words.PushBack(std::string(1, c));
+    }
+    const std::string joined = ParallelReduce(kFourThreads, words,
+                                              std::string(">"));
+    assert(joined == ">abcdefghijklmnopqrstuvwxyz");
+  }
+
+  // Подсчёт
+  {
+    assert(ParallelCountIf(kFourThreads, list,
+                           [](int value) { return value % 2 == 0; }) == 500u);
+    assert(ParallelCountIf(kParallel, list,
+                           [](int value) { return value > 1000; }) == 1u);
+
+    UnrolledSingleLinkedList<int, 4> unrolled;
+    for (int i = 0; i < 103; ++i) {
+      unrolled.PushFront(i);
+    }
+    assert(ParallelCountIf(kFourThreads, unrolled,
+                           [](int value) { return value < 3; }) == 3u);
+    assert(ParallelReduce(kFourThreads, unrolled, 0) == 102 * 103 / 2);
+  }
+
+  // Обработка каждого элемента
+  {
+    ParallelForEach(kFourThreads, list, [](int &value) { value *= 2; });
+    assert(ParallelReduce(kFourThreads, list, 0) == 1001 * 1002);
+
+    std::atomic<int> visited{0};
+    ParallelForEach(kFourThreads, std::as_const(list),
+                    [&visited](const int &) { visited.fetch_add(1); });
+    assert(visited.load() == 1001);
+  }
+
+  // Исключение из любого сегмента передаётся вызывающему потоку
+  {
+    bool thrown = false;
+    try {
+      ParallelForEach(kFourThreads, list, [](int value) {
+        if (value == 2) {
+          throw std::runtime_error("first segment");
+        }
+      });
+    } catch (const std::runtime_error &error) {
+      thrown = error.what() == "first segment"s;
+    }
+    assert(thrown);
+  }
+}
+
+void Test17() {
+  constexpr ParallelPolicy kFourThreads{4, 1};
+  using IntList = SingleLinkedList<int>;
+
+  IntList lhs;
+  for (int i = 0; i < 1000; ++i) {
+    lhs.PushBack(i);
+  }
+
+  // Равенство и позиция первого различия
+  {
+    IntList rhs(lhs);
+    assert(ParallelEqual(kFourThreads, lhs, rhs));
+    assert(ParallelMismatch(kFourThreads, lhs, rhs) == 1000u);
+
+    auto it = rhs.begin();
+    std::advance(it, 700);
+    *it = -1;
+    assert(!ParallelEqual(kFourThreads, lhs, rhs));
+    assert(ParallelMismatch(kFourThreads, lhs, rhs) == 700u);
+
+    // Различие в нескольких сегментах: сообщается самое раннее
+    *rhs.begin() = 5;
+    assert(ParallelMismatch(kFourThreads, lhs, rhs) == 0u);
+
+    rhs.PopFront();
+    assert(!ParallelEqual(kFourThreads, lhs, rhs));
+    assert(ParallelEqual(kParallel, IntList(), IntList()));
+  }
+
+  // Лексикографическое сравнение совпадает с последовательным
+  {
+    IntList rhs(lhs);
+    auto compare = ParallelCompareThreeWay(kFourThreads, lhs, rhs);
+    assert(compare.result.equal && compare.result.order == 0);
+    assert(compare.mismatch == 1000u);
+
+    auto it = rhs.begin();
+    std::advance(it, 512);
+    *it = 10000;
+    compare = ParallelCompareThreeWay(kFourThreads, lhs, rhs);
+    assert(!compare.result.equal && compare.result.order < 0);
+    assert(compare.mismatch == 512u);
+    assert(ParallelLess(kFourThreads, lhs, rhs) == (lhs < rhs));
+    assert(ParallelLess(kFourThreads, rhs, lhs) == (rhs < lhs));
+
+    IntList prefix{0, 1, 2};
+    compare = ParallelCompareThreeWay(kFourThreads, prefix, lhs);
+    assert(compare.result.order < 0 && compare.mismatch == 3u);
+    assert(ParallelLess(kFourThreads, prefix, lhs));
+    assert(!ParallelLess(kFourThreads, lhs, prefix));
+
+    UnrolledSingleLinkedList<int, 8> unrolled;
+    for (int value : lhs) {
+      unrolled.PushBack(value);
+    }
+    assert(ParallelEqual(kFourThreads, lhs, unrolled));
+    assert(ParallelLess(kFourThreads, unrolled, rhs));
+  }
+
+  // Эквивалентные, но не равные элементы
+  {
+    struct Loose {
+      bool operator==(const Loose &) const { return false; }
+      bool operator<(const Loose &) const { return false; }
+    };
+    SingleLinkedList<Loose> loose_lhs{Loose{}, Loose{}};
+    SingleLinkedList<Loose> loose_rhs{Loose{}, Loose{}};
+    const auto compare =
+        ParallelCompareThreeWay(kFourThreads, loose_lhs, loose_rhs);
+    assert(!compare.result.equal && compare.result.order == 0);
+    assert(compare.mismatch == 2u);
+    assert(!ParallelLess(kFourThreads, loose_lhs, loose_rhs));
+    assert(detail::IsGreater(compare.result) == (loose_lhs > loose_rhs));
+  }
+}
+
+// Сверяет векторные ядра со скалярными для фрагментов любой длины и любой
+// позиции различия, в том числе внутри регистра и в хвосте фрагмента
+template <typename Type>
+void CheckSimdKernels() {
+  std::vector<Type> lhs;
+  for (int i = 0; i < 70; ++i) {
+    lhs.push_back(static_cast<Type>(i % 9));
+  }
+  for (size_t count = 0; count <= lhs.size(); ++count) {
+    assert(simd::Mismatch(lhs.data(), lhs.data(), count) == count);
+    for (size_t position = 0; position < count; ++position) {
+      std::vector<Type> rhs(lhs);
+      rhs[position] = static_cast<Type>(100);
+      assert(simd::Mismatch(lhs.data(), rhs.data(), count) == position);
+      assert(simd::Find(rhs.data(), count, static_cast<Type>(100)) ==
+             position);
+      assert(simd::Count(rhs.data(), count, static_cast<Type>(100)) == 1u);
+
+      const auto compare = simd::CompareThreeWay(lhs.data(), rhs.data(), count);
+      assert(compare.order < 0 && !compare.equal);
+      assert(simd::CompareThreeWay(rhs.data(), lhs.data(), count).order > 0);
+    }
+    const Type needle = static_cast<Type>(3);
+    assert(simd::Count(lhs.data(), count, needle) ==
+           static_cast<size_t>(std::count(lhs.begin(),
+                                          lhs.begin() + count, needle)));
+    assert(simd::Find(lhs.data(), count, needle) ==
+           static_cast<size_t>(std::find(lhs.begin(), lhs.begin() + count,
+                                         needle) -
+                               lhs.begin()));
+  }
+}
+
+void Test18() {
+  static_assert(simd::kIsVectorizable<int>);
+  static_assert(simd::kIsVectorizable<uint64_t>);
+  static_assert(simd::kIsVectorizable<double>);
+  static_assert(!simd::kIsVectorizable<bool>);
+  static_assert(!simd::kIsVectorizable<std::string>);
+
+  CheckSimdKernels<int>();
+  CheckSimdKernels<uint32_t>();
+  CheckSimdKernels<int64_t>();
+  CheckSimdKernels<float>();
+  CheckSimdKernels<double>();
+  CheckSimdKernels<short>();
+
+  // Числа с плавающей точкой сравниваются как значения, а не как байты
+  {
+    const std::vector<double> zeros(9, 0.0);
+    const std::vector<double> negative_zeros(9, -0.0);
+    assert(simd::Mismatch(zeros.data(), negative_zeros.data(), 9) == 9u);
+    assert(simd::Count(negative_zeros.data(), 9, 0.0) == 9u);
+
+    std::vector<float> with_nan(17, 1.0f);
+    with_nan[10] = std::nanf("");
+    assert(simd::Mismatch(with_nan.data(), with_nan.data(), 17) == 10u);
+    assert(simd::Find(with_nan.data(), 17, std::nanf("")) == 17u);
+
+    // NaN эквивалентен любому числу, но не равен ему
+    const auto compare =
+        simd::CompareThreeWay(with_nan.data(), with_nan.data(), 17);
+    assert(compare.order == 0 && !compare.equal);
+  }
+
+  // Развёрнутый список использует ядра для сравнения, поиска и подсчёта
+  {
+    using DoubleList = UnrolledSingleLinkedList<double, 16>;
+    DoubleList lhs;
+    for (int i = 0; i < 100; ++i) {
+      lhs.PushBack(i % 7);
+    }
+    DoubleList rhs(lhs);
+    assert(lhs == rhs);
+    assert(lhs.Count(3.0) == 14u);
+    assert(lhs.Count(100.0) == 0u);
+
+    auto it = lhs.Find(6.0);
+    assert(it != lhs.end() && *it == 6.0);
+    assert(std::distance(lhs.begin(), it) == 6);
+    assert(lhs.Find(-1.0) == lhs.end());
+    assert(std::as_const(lhs).Find(0.0) == lhs.cbegin());
+
+    auto last = rhs.begin();
+    std::advance(last, 99);
+    *last = 10.0;
+    assert(lhs != rhs);
+    assert(lhs < rhs);
+    assert(rhs.Find(10.0) == last);
+
+    UnrolledSingleLinkedList<std::string, 4> words{"a", "b", "a"};
+    assert(words.Count("a") == 2u);
+    assert(*++words.Find("a") == "b");
+  }
+}
+
+void Test19() {
+  // Арена переиспользует блоки после сброса
+  {
+    ArenaResource arena(256);
+    void *first = arena.allocate(100, 8);
+    void *second = arena.allocate(100, 8);
+    void *aligned = arena.allocate(1000, 64);
+    assert(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    const size_t blocks = arena.GetBlockCount();
+    assert(blocks >= 2u);
+    arena.Reset();
+    assert(arena.allocate(100, 8) == first);
+    assert(arena.allocate(100, 8) == second);
+    assert(arena.allocate(1000, 64) == aligned);
+    assert(arena.GetBlockCount() == blocks);
+    arena.Release();
+    assert(arena.GetBlockCount() == 0u);
+  }
+
+  // Список элементов с тривиальным деструктором
+  {
+    ArenaSingleLinkedList<int> list;
+    for (int i = 0; i < 1000; ++i) {
+      list.PushFront(i);
+    }
+    assert(list.GetSize() == 1000u);
+    const size_t blocks = list.GetArena().GetBlockCount();
+
+    list.Clear();
+    assert(list.IsEmpty());
+    assert(list.begin() == list.end());
+
+    // Повторное заполнение использует уже полученные блоки
+    for (int i = 0; i < 1000; ++i) {
+      list.PushBack(i);
+    }
+    assert(list.GetArena().GetBlockCount() == blocks);
+    assert(*list.begin() == 0);
+
+    ArenaSingleLinkedList<int> copy(list);
+    assert(copy == list);
+    list.Clear();
+    assert(copy.GetSize() == 1000u);
+    list = copy;
+    assert(list == copy);
+
+    ArenaSingleLinkedList<int> small{1, 2, 3};
+    small.PushBack(4);
+    assert((small == ArenaSingleLinkedList<int>{1, 2, 3, 4}));
+  }
+
+  // Копия создаёт арену с тем же размером первого блока
+  {
+    ArenaSingleLinkedList<int> list(1 << 16);
+    for (int i = 0; i < 1000; ++i) {
+      list.PushFront(i);
+    }
+    assert(list.GetArena().GetBlockCount() == 1u);
+    const ArenaSingleLinkedList<int> copy(list);
+    assert(copy == list);
+    assert(copy.GetArena().GetInitialBlockBytes() == 1u << 16);
+    assert(copy.GetArena().GetBlockCount() == 1u);
+  }
+
+  // Узлы из арены нельзя передать другому списку
+  {
+    using Arena = ArenaSingleLinkedList<int>;
+    static_assert(
+        !std::is_convertible_v<Arena &, ::pmr::SingleLinkedList<int> &>);
+    static_assert(
+        !std::is_constructible_v<::pmr::SingleLinkedList<int>, Arena &&>);
+    Arena list{3, 1, 3, 3, 2};
+    assert((list != Arena{3, 1, 3}));
+    assert((Arena{3, 1, 3} < list));
+    assert(list.Remove(1) == 1u);
+    assert(list.Unique() == 2u);
+    assert(list.RemoveIf([](int value) { return value == 2; }) == 1u);
+    assert(list.EraseAfter(list.before_begin(), list.end()) == 1u);
+    assert(list.IsEmpty());
+  }
+
+  // Элементы с нетривиальным деструктором разрушаются
+  {
+    struct DeletionSpy {
+      ~DeletionSpy() {
+        if (deletion_counter_ptr) {
+          ++(*deletion_counter_ptr);
+        }
+      }
+      int *deletion_counter_ptr = nullptr;
+    };
+    int item_counter = 0;
+    {
+      ArenaSingleLinkedList<DeletionSpy> list;
+      for (int i = 0; i < 10; ++i) {
+        list.PushFront(DeletionSpy{});
+        list.begin()->deletion_counter_ptr = &item_counter;
+      }
+      list.Clear();
+      assert(item_counter == 10);
+      list.PushFront(DeletionSpy{});
+      list.begin()->deletion_counter_ptr = &item_counter;
+    }
+    assert(item_counter == 11);
+
+    ArenaSingleLinkedList<std::string> words;
+    words.PushFront(std::string(100, 'x'));
+    words.Clear();
+    words.PushFront("short");
+    assert(*words.begin() == "short");
+  }
+}
+
+void Test20() {
+  // Узлы хранятся в одном буфере и переиспользуются после удаления
+  {
+    IndexedSingleLinkedList<int> list;
+    assert(list.IsEmpty());
+    assert(list.begin() == list.end());
+    for (int i = 0; i < 100; ++i) {
+      list.PushBack(i);
+    }
+    assert(list.GetSize() == 100u);
+    assert(list.GetCapacity() >= 100u);
+    int expected = 0;
+    for (int value : list) {
+      assert(value == expected++);
+    }
+
+    const size_t capacity = list.GetCapacity();
+    while (!list.IsEmpty()) {
+      list.PopFront();
+    }
+    for (int i = 0; i < 100; ++i) {
+      list.PushFront(i);
+    }
+    assert(list.GetCapacity() == capacity);
+    assert(*list.begin() == 99);
+
+    // Итераторы остаются действительными при увеличении буфера
+    IndexedSingleLinkedList<int> growing{1};
+    auto it = growing.begin();
+    for (int i = 0; i < 1000; ++i) {
+      growing.InsertAfter(it, i);
+    }
+    assert(*it == 1);
+    assert(*std::next(it) == 999);
+    assert(growing.GetSize() == 1001u);
+  }
+
+  // Вставка и удаление в произвольных позициях
+  {
+    IndexedSingleLinkedList<int> list{1, 2, 4};
+    auto pos = list.InsertAfter(std::next(list.cbegin()), 3);
+    assert(*pos == 3);
+    assert((list == IndexedSingleLinkedList<int>{1, 2, 3, 4}));
+
+    auto after = list.EraseAfter(list.cbegin());
+    assert(*after == 3);
+    assert((list == IndexedSingleLinkedList<int>{1, 3, 4}));
+
+    // Удаление последнего элемента обновляет хвост
+    list.EraseAfter(std::next(list.cbegin()));
+    list.PushBack(5);
+    assert((list == IndexedSingleLinkedList<int>{1, 3, 5}));
+
+    list.EmplaceFront(0);
+    assert((list == IndexedSingleLinkedList<int>{0, 1, 3, 5}));
+    list.Clear();
+    assert(list.IsEmpty());
+    list.PushBack(7);
+    assert((list == IndexedSingleLinkedList<int>{7}));
+  }
+
+  // Копирование, перемещение и сравнение
+  {
+    IndexedSingleLinkedList<int> list{1, 2, 3};
+    list.EraseAfter(list.cbegin());
+    IndexedSingleLinkedList<int> copy(list);
+    assert(copy == list);
+    copy.PushBack(4);
+    assert((copy == IndexedSingleLinkedList<int>{1, 3, 4}));
+    assert(list < copy);
+    assert(copy > list);
+    assert(list <= list);
+    assert(list != copy);
+
+    IndexedSingleLinkedList<int> moved(std::move(copy));
+    assert(copy.IsEmpty());
+    assert(moved.GetSize() == 3u);
+    copy = moved;
+    assert(copy == moved);
+    list = std::move(moved);
+    assert((list == IndexedSingleLinkedList<int>{1, 3, 4}));
+
+    swap(list, copy);
+    list.Clear();
+    assert((copy == IndexedSingleLinkedList<int>{1, 3, 4}));
+  }
+
+  // Элементы без тривиального копирования переносятся по одному
+  {
+    IndexedSingleLinkedList<std::string> words;
+    for (int i = 0; i < 100; ++i) {
+      words.PushBack(std::string(50, static_cast<char>('a' + i % 26)));
+    }
+    words.EraseAfter(words.cbefore_begin());
+    words.PushFront("front");
+    IndexedSingleLinkedList<std::string> copy(words);
+    assert(copy == words);
+    assert(*copy.begin() == "front");
+    words.Reserve(1000);
+    assert(words.GetCapacity() >= 1000u);
+    assert(copy == words);
+  }
+
+  // Исключение при конструировании элемента оставляет список без изменений
+  {
+    struct ThrowOnCopy {
+      ThrowOnCopy() = default;
+      ThrowOnCopy(const ThrowOnCopy &other) : value(other.value) {
+        if (value < 0) {
+          throw std::runtime_error("copy");
+        }
+      }
+      ThrowOnCopy(ThrowOnCopy &&) noexcept = default;
+      int value = 0;
+    };
+    IndexedSingleLinkedList<ThrowOnCopy> list;
+    list.PushBack(ThrowOnCopy{});
+    ThrowOnCopy bad;
+    bad.value = -1;
+    try {
+      list.PushBack(bad);
+      assert(false);
+    } catch (const std::runtime_error &) {
+    }
+    assert(list.GetSize() == 1u);
+    list.PushBack(ThrowOnCopy{});
+    assert(list.GetSize() == 2u);
+
+    list.begin()->value = -1;
+    try {
+      IndexedSingleLinkedList<ThrowOnCopy> copy(list);
+      assert(false);
+    } catch (const std::runtime_error &) {
+    }
+  }
+
+  // Вставка элемента самого списка в заполненный буфер
+  {
+    IndexedSingleLinkedList<std::string> words;
+    for (int i = 0; i < 8; ++i) {
+      words.PushBack(std::string(50, static_cast<char>('a' + i)));
+    }
+    assert(words.GetCapacity() == 8u);
+    words.PushBack(*words.begin());
+    assert(words.GetCapacity() == 16u);
+    assert(*std::next(words.begin(), 8) == std::string(50, 'a'));
+
+    IndexedSingleLinkedList<int> numbers{1, 2, 3, 4, 5, 6, 7, 8};
+    assert(numbers.GetCapacity() == 8u);
+    numbers.PushFront(*std::next(numbers.begin(), 7));
+    assert((numbers == IndexedSingleLinkedList<int>{8, 1, 2, 3, 4, 5, 6, 7,
+                                                    8}));
+  }
+
+  // Список использует переданный аллокатор
+  {
+    int allocations = 0;
+    int deallocations = 0;
+    {
+      IndexedSingleLinkedList<int, CountingAllocator<int>> list(
+          CountingAllocator<int>(&allocations, &deallocations));
+      for (int i = 0; i < 100; ++i) {
+        list.PushFront(i);
+      }
+      // Буфер увеличивается вдвое: 8, 16, 32, 64, 128
+      assert(allocations == 5);
+      assert(deallocations == 4);
+    }
+    assert(deallocations == allocations);
+  }
+
+  // Присваивание списков с полиморфными аллокаторами: аллокатор не
+  // распространяется, и буфер размещается ресурсом получателя
+  {
+    using PmrList =
+        IndexedSingleLinkedList<int, std::pmr::polymorphic_allocator<int>>;
+    std::pmr::monotonic_buffer_resource shared;
+    std::pmr::monotonic_buffer_resource other_resource;
+    const PmrList source({1, 2, 3, 4, 5}, &shared);
+    PmrList same({9}, &shared);
+    same = source;
+    assert(same == source);
+    PmrList foreign({9}, &other_resource);
+    foreign = source;
+    assert(foreign == source);
+    assert(foreign.get_allocator().resource() == &other_resource);
+
+    foreign = PmrList({6, 7}, &shared);
+    assert((foreign == PmrList({6, 7}, &shared)));
+    assert(foreign.get_allocator().resource() == &other_resource);
+    same = PmrList({8}, &shared);
+    assert((same == PmrList({8}, &shared)));
+  }
+}
+
+void Test21() {
+  // Копия разделяет узлы и не выделяет памяти
+  {
+    int allocations = 0;
+    int deallocations = 0;
+    using List = PersistentSingleLinkedList<int, CountingAllocator<int>>;
+    {
+      List list({1, 2, 3, 4}, CountingAllocator<int>(&allocations,
+                                                     &deallocations));
+      assert(allocations == 4);
+      List copy(list);
+      assert(allocations == 4);
+      assert(copy == list);
+      assert(&*copy.begin() == &*list.begin());
+
+      // Добавление в начало копии не копирует узлы
+      copy.PushFront(0);
+      assert(allocations == 5);
+      assert(&*std::next(copy.begin()) == &*list.begin());
+      assert((list == List({1, 2, 3, 4}, list.get_allocator())));
+
+      // Вставка в середину копирует только путь до места вставки
+      const int before_insert = allocations;
+      auto pos = copy.InsertAfter(std::next(copy.begin(), 2), 10);
+      assert(*pos == 10);
+      assert(allocations == before_insert + 3);
+      assert(&*std::next(pos) == &*std::next(list.begin(), 2));
+      assert((copy == List({0, 1, 2, 10, 3, 4}, list.get_allocator())));
+      assert((list == List({1, 2, 3, 4}, list.get_allocator())));
+
+      // Узлы, принадлежащие только копии, изменяются на месте
+      const int before_in_place = allocations;
+      copy.EraseAfter(std::next(copy.begin(), 2));
+      assert(allocations == before_in_place);
+      assert((copy == List({0, 1, 2, 3, 4}, list.get_allocator())));
+
+      // Удаление разделяемого узла не затрагивает оригинал
+      copy.EraseAfter(std::next(copy.begin(), 3));
+      assert((copy == List({0, 1, 2, 3}, list.get_allocator())));
+      assert((list == List({1, 2, 3, 4}, list.get_allocator())));
+
+      copy.PopFront();
+      copy.PopFront();
+      assert(&*copy.begin() != &*std::next(list.begin()));
+      list.Clear();
+      assert((copy == List({2, 3}, copy.get_allocator())));
+    }
+    assert(deallocations == allocations);
+  }
+
+  // Присваивание, перемещение и сравнение
+  {
+    PersistentSingleLinkedList<std::string> list{"a", "b", "c"};
+    PersistentSingleLinkedList<std::string> other{"x"};
+    other = list;
+    assert(other == list);
+    other = other;
+    assert(other == list);
+    other.PopFront();
+    list = other;
+    assert(&*list.begin() == &*other.begin());
+    assert((list == PersistentSingleLinkedList<std::string>{"b", "c"}));
+
+    PersistentSingleLinkedList<std::string> moved(std::move(other));
+    assert(other.IsEmpty());
+    assert(moved.GetSize() == 2u);
+    other = std::move(moved);
+    assert(other == list);
+    other.PushFront("a");
+    assert(list > other);
+    assert(other < list);
+    assert(other != list);
+    swap(other, list);
+    assert(list.GetSize() == 3u);
+  }
+
+  // Разрушение длинной цепочки не рекурсивно
+  {
+    PersistentSingleLinkedList<int> list;
+    for (int i = 0; i < 1'000'000; ++i) {
+      list.PushFront(i);
+    }
+    PersistentSingleLinkedList<int> copy(list);
+    list.Clear();
+    assert(copy.GetSize() == 1'000'000u);
+  }
+
+  // Исключение при копировании пути оставляет список без изменений
+  {
+    struct ThrowOnCopy {
+      explicit ThrowOnCopy(int v) : value(v) {}
+      ThrowOnCopy(const ThrowOnCopy &other) : value(other.value) {
+        if (value < 0) {
+          throw std::runtime_error("copy");
+        }
+      }
+      bool operator==(const ThrowOnCopy &rhs) const {
+        return value == rhs.value;
+      }
+      int value;
+    };
+    PersistentSingleLinkedList<ThrowOnCopy> list;
+    list.EmplaceFront(2);
+    list.EmplaceFront(-1);
+    list.EmplaceFront(0);
+    PersistentSingleLinkedList<ThrowOnCopy> copy(list);
+    try {
+      copy.EmplaceAfter(std::next(copy.begin(), 2), 3);
+      assert(false);
+    } catch (const std::runtime_error &) {
+    }
+    assert(copy == list);
+    assert(&*copy.begin() == &*list.begin());
+  }
+
+  // Копии используются и разрушаются в разных потоках
+  {
+    PersistentSingleLinkedList<int> list;
+    for (int i = 0; i < 1000; ++i) {
+      list.PushFront(i);
+    }
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+      readers.emplace_back([snapshot = list]() mutable {
+        long long sum = 0;
+        for (int value : snapshot) {
+          sum += value;
+        }
+        assert(sum == 999 * 1000 / 2);
+        snapshot.EraseAfter(std::next(snapshot.begin(), 500));
+        snapshot.PopFront();
+      });
+    }
+    for (int i = 0; i < 100; ++i) {
+      list.EraseAfter(std::next(list.begin(), 10));
+      list.PushFront(i);
+    }
+    for (auto &reader : readers) {
+      reader.join();
+    }
+    assert(list.GetSize() == 1000u);
+  }
+
+  // Перемещение между списками с разными полиморфными ресурсами копирует
+  // элементы в узлы ресурса получателя
+  {
+    using PmrList =
+        PersistentSingleLinkedList<int, std::pmr::polymorphic_allocator<int>>;
+    std::pmr::monotonic_buffer_resource shared;
+    std::pmr::monotonic_buffer_resource other_resource;
+    PmrList foreign({9}, &other_resource);
+    foreign = PmrList({1, 2, 3}, &shared);
+    assert((foreign == PmrList({1, 2, 3}, &shared)));
+    assert(foreign.get_allocator().resource() == &other_resource);
+    PmrList same({9}, &shared);
+    same = PmrList({4, 5}, &shared);
+    assert((same == PmrList({4, 5}, &shared)));
+  }
+}
+
+void Test22() {
+  // Хеш списка зависит от элементов и их порядка
+  {
+    using List = SingleLinkedList<int>;
+    const std::hash<List> hasher;
+    assert(hasher(List{1, 2, 3}) == hasher(List{1, 2, 3}));
+    assert(hasher(List{1, 2, 3}) != hasher(List{3, 2, 1}));
+    assert(hasher(List{}) != hasher(List{0}));
+
+    using Strings = SingleLinkedList<std::string>;
+    assert(std::hash<Strings>()(Strings{""}) !=
+           std::hash<Strings>()(Strings{"", ""}));
+
+    std::unordered_set<List> lists{List{1}, List{1, 2}, List{2, 1}};
+    assert(lists.size() == 3u);
+    assert(lists.count(List{1, 2}) == 1u);
+    assert(lists.count(List{2}) == 0u);
+  }
+
+  // Отпечаток обновляется при каждом изменении
+  {
+    using List = FingerprintedSingleLinkedList<int>;
+    List list{1, 2, 3};
+    const List same{1, 2, 3};
+    assert(list.GetFingerprint() == same.GetFingerprint());
+    assert(list == same);
+
+    list.PushFront(0);
+    assert(list.GetFingerprint() != same.GetFingerprint());
+    assert(list != same);
+    list.PopFront();
+    assert(list.GetFingerprint() == same.GetFingerprint());
+    assert(list == same);
+
+    auto pos = list.InsertAfter(list.begin(), 5);
+    assert(*pos == 5);
+    assert((list == List{1, 5, 2, 3}));
+    list.EraseAfter(list.begin());
+    assert(list == same);
+
+    list.PushBack(4);
+    list.EmplaceBack(4);
+    assert(list.Remove(4) == 2u);
+    assert(list == same);
+    assert(list.RemoveIf([](int value) { return value > 1; }) == 2u);
+    assert((list == List{1}));
+    assert(list.GetFingerprint() == List{1}.GetFingerprint());
+
+    // Отпечаток не зависит от порядка, поэтому перестановка элементов
+    // распознаётся полным сравнением
+    List reversed{3, 2, 1};
+    assert(reversed.GetFingerprint() == same.GetFingerprint());
+    assert(reversed != same);
+    assert(same < reversed);
+    reversed.Sort();
+    assert(reversed == same);
+
+    list.Clear();
+    assert(list.GetFingerprint() == List{}.GetFingerprint());
+
+    List copy(same);
+    assert(copy == same);
+    List moved(std::move(copy));
+    assert(moved == same);
+    assert(copy.GetFingerprint() == 0u);
+    swap(moved, list);
+    assert(list == same);
+    assert(moved.IsEmpty());
+  }
+
+  // Списки с отпечатками как ключи std::unordered_map
+  {
+    using Key = FingerprintedSingleLinkedList<std::string>;
+    std::unordered_map<Key, int> counts;
+    ++counts[Key{"a", "b"}];
+    ++counts[Key{"b", "a"}];
+    ++counts[Key{"a", "b"}];
+    assert(counts.size() == 2u);
+    assert((counts[Key{"a", "b"}] == 2));
+  }
+}
+
+void Test23() {
+  using List = PositionalSingleLinkedList<int>;
+
+  // Проверяет, что все элементы, найденные по номеру, совпадают с
+  // найденными обходом списка
+  auto check_positions = [](List &list) {
+    size_t position = 0;
+    for (auto it = list.begin(); it != list.end(); ++it, ++position) {
+      assert(list.IteratorAt(position) == it);
+    }
+    // Обращения в обратном порядке используют опорные точки
+    for (size_t i = list.GetSize(); i > 0; --i) {
+      assert(&list.At(i - 1) == &*std::next(list.begin(), i - 1));
+    }
+  };
+
+  // Доступ по номеру и переходы
+  {
+    List list;
+    for (int i = 0; i < 1000; ++i) {
+      list.PushBack(i);
+    }
+    assert(list.At(999) == 999);
+    assert(list.At(500) == 500);
+    assert(list.At(0) == 0);
+    list.At(10) = -10;
+    assert(*std::next(list.begin(), 10) == -10);
+    list.At(10) = 10;
+    check_positions(list);
+
+    auto it = list.IteratorAt(100);
+    assert(*list.Advance(it, 50) == 150);
+    assert(*list.Advance(list.begin(), 700) == 700);
+    assert(*list.Advance(list.before_begin(), 1) == 0);
+    assert(list.Advance(list.begin(), 1000) == list.end());
+    // Итератор с неизвестным номером продвигается линейно
+    assert(*list.Advance(std::next(list.begin(), 3), 4) == 7);
+  }
+
+  // Изменения в начале и в конце сохраняют индекс
+  {
+    List list;
+    for (int i = 0; i < 500; ++i) {
+      list.PushBack(i);
+    }
+    assert(list.At(499) == 499);
+    for (int i = 1; i <= 200; ++i) {
+      list.PushFront(-i);
+    }
+    assert(list.At(200) == 0);
+    assert(list.At(699) == 499);
+    assert(list.At(0) == -200);
+    for (int i = 0; i < 300; ++i) {
+      list.PopFront();
+    }
+    assert(list.At(0) == 100);
+    assert(list.At(399) == 499);
+    list.PushBack(500);
+    assert(list.At(400) == 500);
+    check_positions(list);
+  }
+
+  // Вставка и удаление в середине
+  {
+    List list;
+    for (int i = 0; i < 1000; ++i) {
+      list.PushBack(i);
+    }
+    assert(list.At(900) == 900);
+
+    // Номер элемента, найденного последним, известен
+    auto pos = list.IteratorAt(300);
+    list.InsertAfter(pos, -1);
+    assert(list.At(301) == -1);
+    assert(list.At(900) == 899);
+    list.EraseAfter(list.IteratorAt(300));
+    assert(list.At(301) == 301);
+
+    // Номер произвольного итератора неизвестен: индекс сбрасывается
+    list.InsertAfter(std::next(list.begin(), 10), -2);
+    assert(list.At(11) == -2);
+    assert(list.At(999) == 998);
+    list.EraseAfter(std::next(list.begin(), 10));
+    list.EraseAfter(list.cbefore_begin());
+    list.InsertAfter(list.cbefore_begin(), 0);
+    list.InsertAfter(std::next(list.begin(), 999), 1000);
+    assert(list.At(1000) == 1000);
+    check_positions(list);
+
+    assert(list.Remove(1000) == 1u);
+    assert(list.RemoveIf([](int value) { return value % 2 == 1; }) == 500u);
+    assert(list.At(499) == 998);
+    list.Sort(std::greater<>());
+    assert(list.At(0) == 998);
+    check_positions(list);
+  }
+
+  // Копирование, перемещение и сравнение
+  {
+    List list{1, 2, 3};
+    assert(list.At(2) == 3);
+    List copy(list);
+    assert(copy == list);
+    assert(copy.At(2) == 3);
+    assert(&copy.At(2) != &list.At(2));
+
+    List moved(std::move(copy));
+    assert(moved.At(1) == 2);
+    assert(copy.IsEmpty());
+    copy = moved;
+    copy.PushBack(4);
+    assert(copy > list);
+    assert(copy != list);
+    swap(copy, moved);
+    assert(moved.At(3) == 4);
+    list.Clear();
+    assert(list.IsEmpty());
+    list.PushBack(7);
+    assert(list.At(0) == 7);
+  }
+
+  // Перемещающее присваивание списков с полиморфными аллокаторами: при
+  // разных ресурсах элементы переносятся в новые узлы, и индекс строится
+  // заново
+  {
+    using PmrList =
+        PositionalSingleLinkedList<int, std::pmr::polymorphic_allocator<int>>;
+    std::pmr::monotonic_buffer_resource shared;
+    std::pmr::monotonic_buffer_resource other_resource;
+    auto make_list = [](std::pmr::memory_resource *resource) {
+      PmrList list(resource);
+      for (int i = 0; i < 300; ++i) {
+        list.PushBack(i);
+      }
+      assert(list.At(299) == 299);
+      return list;
+    };
+    PmrList foreign({9}, &other_resource);
+    foreign = make_list(&shared);
+    assert(foreign.get_allocator().resource() == &other_resource);
+    for (size_t i = 300; i > 0; --i) {
+      assert(&foreign.At(i - 1) == &*std::next(foreign.begin(), i - 1));
+    }
+    PmrList same({9}, &shared);
+    same = make_list(&shared);
+    for (size_t i = 300; i > 0; --i) {
+      assert(&same.At(i - 1) == &*std::next(same.begin(), i - 1));
+    }
+  }
+}
+
+void Test24() {
+  // Без SLL_ENABLE_STATS статистика не собирается и не занимает места
+  if constexpr (!kListStatsEnabled) {
+    SingleLinkedList<int> list{1, 2, 3};
+    assert(list.GetStats().node_allocations == 0u);
+    assert(GetGlobalListStats().node_allocations == 0u);
+    return;
+  }
+
+  ResetGlobalListStats();
+  {
+    SingleLinkedList<int> list{1, 2, 3};
+    list.PushFront(0);
+    ListStats stats = list.GetStats();
+    assert(stats.node_allocations == 4u);
+    assert(stats.max_size == 4u);
+
+    // Узлы из запаса не запрашиваются у аллокатора повторно
+    list.Reserve(10);
+    list.PushBack(4);
+    assert(list.GetStats().node_allocations == 10u);
+    list.ShrinkToFit();
+    assert(list.GetStats().node_deallocations == 5u);
+
+    SingleLinkedList<int> copy(list);
+    assert(copy.GetStats().copy_constructions == 1u);
+    assert(copy.GetStats().node_allocations == 5u);
+    assert(list.GetStats().node_allocations == 10u);
+
+    SingleLinkedList<int> other;
+    other = copy;
+    other = std::move(copy);
+    SingleLinkedList<int> moved(std::move(other));
+    assert(other.GetStats().copy_assignments == 1u);
+    assert(other.GetStats().move_assignments == 1u);
+    assert(other.GetStats().assign_latency.GetCount() == 2u);
+    assert(moved.GetStats().move_constructions == 1u);
+
+    assert(moved == list);
+    assert(!(moved < list));
+    assert(moved.GetStats().comparisons == 2u);
+    assert(list.GetStats().comparisons == 2u);
+
+    list.Clear();
+    stats = list.GetStats();
+    assert(stats.clears == 1u);
+    assert(stats.clear_latency.GetCount() == 1u);
+    assert(stats.node_deallocations == 10u);
+    // Наибольшая длина сохраняется после очистки
+    assert(stats.max_size == 5u);
+
+    list.ResetStats();
+    assert(list.GetStats().node_allocations == 0u);
+    assert(list.GetStats().clear_latency.GetCount() == 0u);
+  }
+
+  // Общая статистика объединяет все списки
+  const ListStats global = GetGlobalListStats();
+  // Копирующее присваивание в пустой список создало 5 узлов во временном
+  // списке
+  assert(global.node_allocations == 20u);
+  assert(global.node_deallocations == global.node_allocations);
+  assert(global.copy_constructions == 1u);
+  assert(global.comparisons == 4u);
+  assert(global.clears == 1u);
+  assert(global.max_size == 5u);
+  assert(global.assign_latency.GetCount() == 2u);
+
+  assert(LatencyHistogram::GetBucket(0) == 0u);
+  assert(LatencyHistogram::GetBucket(1) == 1u);
+  assert(LatencyHistogram::GetBucket(1000) == 10u);
+  assert(LatencyHistogram::GetBucket(UINT64_MAX) ==
+         LatencyHistogram::kBucketCount - 1);
+  ResetGlobalListStats();
+  assert(GetGlobalListStats().node_allocations == 0u);
+}
+
+void Test25() {
+  // Сериализация в поток и обратно
+  {
+    SingleLinkedList<int> list;
+    for (int i = 0; i < 100'000; ++i) {
+      list.PushBack(i * 3);
+    }
+    std::stringstream stream;
+    SerializeList(list, stream);
+    assert(stream.str().size() ==
+           kListFileDataOffset + list.GetSize() * sizeof(int));
+    const auto restored = DeserializeList<int>(stream);
+    assert(restored == list);
+
+    // Элементы любого списка записываются в одном формате
+    std::stringstream unrolled_stream;
+    UnrolledSingleLinkedList<int> unrolled;
+    for (int value : list) {
+      unrolled.PushBack(value);
+    }
+    SerializeList(unrolled, unrolled_stream);
+    assert(unrolled_stream.str() == stream.str());
+
+    std::stringstream empty_stream;
+    SerializeList(SingleLinkedList<double>{}, empty_stream);
+    assert(DeserializeList<double>(empty_stream).IsEmpty());
+
+    struct Point {
+      int16_t x;
+      int64_t y;
+      bool operator==(const Point &rhs) const {
+        return x == rhs.x && y == rhs.y;
+      }
+    };
+    std::stringstream points_stream;
+    const SingleLinkedList<Point> points{{1, -1}, {2, -2}};
+    SerializeList(points, points_stream);
+    assert(DeserializeList<Point>(points_stream) == points);
+  }
+
+  // Повреждённые данные и другой тип элементов обнаруживаются
+  {
+    std::stringstream stream;
+    SerializeList(SingleLinkedList<int>{1, 2, 3}, stream);
+    const std::string bytes = stream.str();
+
+    auto throws = [](const std::string &data, auto read) {
+      std::stringstream input(data);
+      try {
+        read(input);
+      } catch (const std::runtime_error &) {
+        return true;
+      }
+      return false;
+    };
+    auto read_ints = [](std::istream &input) { DeserializeList<int>(input); };
+    assert(throws(bytes.substr(0, bytes.size() - 1), read_ints));
+    assert(throws(bytes.substr(0, 10), read_ints));
+    assert(throws("X" + bytes.substr(1), read_ints));
+    assert(throws(bytes, [](std::istream &input) {
+      DeserializeList<int64_t>(input);
+    }));
+    assert(!throws(bytes, read_ints));
+  }
+
+  // Представление файла, отображённого в память
+  {
+    char path[] = "/tmp/sll_mapped_XXXXXX";
+    const int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+
+    SingleLinkedList<double> list;
+    for (int i = 0; i < 10'000; ++i) {
+      list.PushBack(i * 0.5);
+    }
+    {
+      std::ofstream output(path, std::ios::binary);
+      SerializeList(list, output);
+    }
+    MappedSingleLinkedList<double> mapped(path);
+    assert(mapped.GetSize() == list.GetSize());
+    assert(std::equal(mapped.begin(), mapped.end(), list.begin()));
+    assert(*std::next(mapped.begin(), 10) == 5.0);
+    assert(ParallelEqual(kSequential, mapped, list));
+
+    MappedSingleLinkedList<double> moved(std::move(mapped));
+    assert(mapped.IsEmpty());
+    assert(mapped.begin() == mapped.end());
+    assert(moved.GetSize() == 10'000u);
+    MappedSingleLinkedList<double> other(path);
+    assert(other == moved);
+    mapped = std::move(other);
+    assert(mapped == moved);
+
+    try {
+      MappedSingleLinkedList<int> wrong_type(path);
+      assert(false);
+    } catch (const std::runtime_error &) {
+    }
+    std::remove(path);
+    try {
+      MappedSingleLinkedList<double> missing(path);
+      assert(false);
+    } catch (const std::system_error &) {
+    }
+    // Отображение остаётся доступным после удаления файла
+    assert(*moved.begin() == 0.0);
+  }
+}
+
+void Test26() {
+  // Построение из генератора и потока без промежуточного контейнера
+  {
+    int next = 0;
+    auto generator = [&next]() -> std::optional<int> {
+      if (next == 1000) {
+        return std::nullopt;
+      }
+      return next++;
+    };
+    SingleLinkedList<int> list(generator);
+    assert(list.GetSize() == 1000u);
+    assert(*list.begin() == 0);
+    assert(std::count(list.begin(), list.end(), 999) == 1);
+
+    std::istringstream input("1 2 3 4 x 5");
+    SingleLinkedList<int> parsed(input);
+    assert((parsed == SingleLinkedList<int>{1, 2, 3, 4}));
+    assert(input.fail() && !input.eof());
+
+    std::istringstream words("alpha beta");
+    SingleLinkedList<std::string> strings{"first"};
+    strings.AppendFrom(words);
+    assert((strings ==
+            SingleLinkedList<std::string>{"first", "alpha", "beta"}));
+    assert(words.eof());
+    strings.PushBack("last");
+    assert(strings.GetSize() == 4u);
+  }
+
+  // Диапазоны с однонаправленными итераторами и итераторами ввода
+  {
+    SingleLinkedList<int> list{1};
+    const std::vector<int> values{2, 3};
+    list.AppendFrom(values);
+    const int array[] = {4, 5};
+    list.AppendFrom(array);
+    struct InputRange {
+      std::istream_iterator<int> begin() const { return first; }
+      std::istream_iterator<int> end() const { return {}; }
+      std::istream_iterator<int> first;
+    };
+    std::istringstream input("6 7");
+    list.AppendFrom(InputRange{std::istream_iterator<int>(input)}, 1);
+    assert((list == SingleLinkedList<int>{1, 2, 3, 4, 5, 6, 7}));
+    list.AppendFrom(list);
+    assert(list.GetSize() == 14u);
+  }
+
+  // Узлы резервируются блоками
+  {
+    int allocations = 0;
+    int deallocations = 0;
+    {
+      CountingAllocator<int> alloc(&allocations, &deallocations);
+      SingleLinkedList<int, CountingAllocator<int>> list(alloc);
+      int next = 0;
+      list.AppendFrom(
+          [&next]() -> std::optional<int> {
+            return next < 10 ? std::optional<int>(next++) : std::nullopt;
+          },
+          4);
+      assert(list.GetSize() == 10u);
+      assert(allocations == 12);
+      assert(list.GetCapacity() == 12u);
+      list.PushBack(10);
+      assert(allocations == 12);
+
+      // Пустой генератор не резервирует узлы
+      list.AppendFrom([]() -> std::optional<int> { return std::nullopt; });
+      assert(allocations == 12);
+    }
+    assert(deallocations == allocations);
+  }
+
+  // Исключение генератора оставляет список прежним
+  {
+    SingleLinkedList<std::string> list{"a", "b"};
+    int calls = 0;
+    try {
+      list.AppendFrom([&calls]() -> std::optional<std::string> {
+        if (++calls == 100) {
+          throw std::runtime_error("generator failed");
+        }
+        return std::string(calls, 'x');
+      });
+      assert(false);
+    } catch (const std::runtime_error &) {
+    }
+    assert((list == SingleLinkedList<std::string>{"a", "b"}));
+    list.PushBack("c");
+    assert(list.GetSize() == 3u);
+  }
+}
+
+void Test27() {
+  // Пакеты передаются в очередь при заполнении и при Flush
+  {
+    BatchingQueue<int> queue;
+    auto producer = queue.MakeProducer(3);
+    producer.Push(1);
+    producer.Push(2);
+    assert(producer.GetPendingSize() == 2u);
+    assert(queue.GetSize() == 0u);
+    assert(queue.TakeAll().IsEmpty());
+    producer.Push(3);
+    assert(producer.GetPendingSize() == 0u);
+    assert(queue.GetSize() == 3u);
+
+    producer.Push(4);
+    queue.Push(5);
+    producer.Flush();
+    assert((queue.TakeAll() == SingleLinkedList<int>{1, 2, 3, 5, 4}));
+    assert(queue.GetSize() == 0u);
+
+    // Потребитель дописывает элементы в свой список
+    SingleLinkedList<int> batch{0};
+    producer.Push(6);
+    {
+      auto moved = std::move(producer);
+      moved.Push(7);
+    }
+    queue.TakeAll(batch);
+    assert((batch == SingleLinkedList<int>{0, 6, 7}));
+  }
+
+  // Закрытая очередь отдаёт оставшиеся элементы, а затем пустой список
+  {
+    BatchingQueue<std::string> queue;
+    queue.Push("last");
+    queue.Close();
+    assert(queue.IsClosed());
+    assert(queue.WaitAndTakeAll().GetSize() == 1u);
+    assert(queue.WaitAndTakeAll().IsEmpty());
+  }
+
+  // Несколько производителей и потребитель в разных потоках
+  {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 10'000;
+    BatchingQueue<std::pair<int, int>> queue;
+    std::vector<std::thread> producers;
+    for (int id = 0; id < kProducers; ++id) {
+      producers.emplace_back([&queue, id] {
+        auto producer = queue.MakeProducer(id + 1);
+        for (int i = 0; i < kPerProducer; ++i) {
+          producer.Emplace(id, i);
+        }
+      });
+    }
+    std::vector<int> next(kProducers, 0);
+    std::thread consumer([&queue, &next] {
+      for (auto batch = queue.WaitAndTakeAll(); !batch.IsEmpty();
+           batch = queue.WaitAndTakeAll()) {
+        for (const auto &[id, value] : batch) {
+          assert(value == next[id]);
+          ++next[id];
+        }
+      }
+    });
+    for (auto &thread : producers) {
+      thread.join();
+    }
+    queue.Close();
+    consumer.join();
+    for (int count : next) {
+      assert(count == kPerProducer);
+    }
+  }
+}
+
+// Список, построенный и изменённый при компиляции
+constexpr int SumStaticList() {
+  StaticSingleLinkedList<int, 8> list{3, 1, 4};
+  list.PushFront(10);
+  auto it = list.InsertAfter(list.begin(), 5);
+  list.EraseAfter(it);
+  list.PopFront();
+  list.PushBack(20);
+  StaticSingleLinkedList<int, 8> copy = list;
+  copy.PushBack(100);
+  int sum = 0;
+  for (int value : copy) {
+    sum = sum * 10 + value;
+  }
+  return sum;
+}
+
+struct StaticSetting {
+  std::string_view name;
+  int value = 0;
+};
+
+constexpr StaticSingleLinkedList<StaticSetting, 4> kStaticSettings{
+    {"width", 80}, {"height", 24}};
+
+constexpr int FindStaticSetting(std::string_view name) {
+  for (const StaticSetting &setting : kStaticSettings) {
+    if (setting.name == name) {
+      return setting.value;
+    }
+  }
+  return -1;
+}
+
+void Test28() {
+  // Операции constexpr-списка вычисляются при компиляции
+  {
+    // Копия содержит 5, 1, 4, 20 и 100
+    static_assert(SumStaticList() == 51700);
+    static_assert(kStaticSettings.GetSize() == 2);
+    static_assert(FindStaticSetting("height") == 24);
+    static_assert(FindStaticSetting("depth") == -1);
+    static_assert(std::is_trivially_destructible_v<
+                  StaticSingleLinkedList<StaticSetting, 4>>);
+    static_assert(StaticSingleLinkedList<int, 2>{1, 2} <
+                  StaticSingleLinkedList<int, 2>{1, 3});
+    static_assert(sizeof(StaticSingleLinkedList<int, 100>) <=
+                  100 * (sizeof(int) + 1) + 4 + 2 * sizeof(size_t));
+  }
+
+  // Узлы удалённых элементов переиспользуются, переполнение обнаруживается
+  {
+    StaticSingleLinkedList<int, 3> list{1, 2, 3};
+    try {
+      list.PushBack(4);
+      assert(false);
+    } catch (const std::length_error &) {
+    }
+    assert((list == StaticSingleLinkedList<int, 3>{1, 2, 3}));
+    list.PopFront();
+    list.EraseAfter(list.begin());
+    list.PushFront(0);
+    list.PushBack(5);
+    assert((list == StaticSingleLinkedList<int, 3>{0, 2, 5}));
+    assert(list.GetSize() == list.GetCapacity());
+  }
+
+  // Элементы с нетривиальным деструктором конструируются при вставке и
+  // разрушаются при удалении
+  {
+    static_assert(!std::is_trivially_destructible_v<
+                  StaticSingleLinkedList<std::string, 4>>);
+    StaticSingleLinkedList<std::string, 4> list{"alpha", "beta"};
+    list.InsertAfter(list.begin(), std::string(100, 'x'));
+    assert(list.GetSize() == 3u);
+    assert(*std::next(list.begin()) == std::string(100, 'x'));
+
+    StaticSingleLinkedList<std::string, 4> moved(std::move(list));
+    assert(list.IsEmpty());
+    assert(moved.GetSize() == 3u);
+    const StaticSingleLinkedList<std::string, 4> copy = moved;
+    assert(copy == moved);
+    list = copy;
+    list.EraseAfter(list.begin());
+    assert((list == StaticSingleLinkedList<std::string, 4>{"alpha", "beta"}));
+    swap(list, moved);
+    assert(moved.GetSize() == 2u && list.GetSize() == 3u);
+    assert(list > moved);
+    moved.Clear();
+    assert(moved.IsEmpty());
+    moved.EmplaceBack(3, 'z');
+    assert(*moved.begin() == "zzz");
+  }
+}
+
+void Test29() {
+  // Фиктивный узел не содержит значения, поэтому тип элементов может не
+  // иметь конструктора по умолчанию
+  {
+    struct NoDefault {
+      explicit NoDefault(int value) : value(value) {}
+      int value;
+    };
+    SingleLinkedList<NoDefault> list;
+    list.EmplaceFront(2);
+    list.EmplaceBack(3);
+    list.EmplaceFront(1);
+    int expected = 1;
+    for (const NoDefault &item : list) {
+      assert(item.value == expected++);
+    }
+    list.EraseAfter(list.before_begin());
+    assert(list.begin()->value == 2);
+    SingleLinkedList<NoDefault> copy = list;
+    assert(copy.GetSize() == 2u);
+    // Счётчики статистики увеличивают размер списка
+    static_assert(kListStatsEnabled ||
+                  sizeof(SingleLinkedList<std::array<char, 256>>) <
+                      sizeof(std::array<char, 256>));
+  }
+
+  // Короткий список не обращается к вышестоящему ресурсу
+  {
+    struct CountingResource : std::pmr::memory_resource {
+      void *do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+      }
+      void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+      }
+      bool do_is_equal(const memory_resource &other) const noexcept override {
+        return this == &other;
+      }
+      int allocations = 0;
+      int deallocations = 0;
+    };
+    CountingResource upstream;
+    const int &allocations = upstream.allocations;
+    const int &deallocations = upstream.deallocations;
+    {
+      SmallSingleLinkedList<std::string, 4> list(&upstream);
+      for (int i = 0; i < 4; ++i) {
+        list.PushBack(std::to_string(i));
+      }
+      assert(list.GetInlineCount() == 4u);
+      assert(allocations == 0);
+
+      // Узлы сверх встроенных размещаются вышестоящим ресурсом
+      list.PushFront("spill");
+      assert(allocations == 1);
+      assert(list.GetInlineCount() == 4u);
+      list.EraseAfter(std::next(list.begin()));
+      list.PushBack("reused");
+      assert(allocations == 1);
+      assert(list.GetSize() == 5u);
+      assert(*list.begin() == "spill");
+    }
+    assert(deallocations == allocations);
+
+    // Перестановка узлов заполненного списка не обращается к вышестоящему
+    // ресурсу. Compact, который перенёс бы элементы из ячеек, недоступен
+    {
+      using Small = SmallSingleLinkedList<int, 4>;
+      auto compact = [](auto &list) -> decltype(list.Compact()) {};
+      static_assert(!std::is_invocable_v<decltype(compact), Small &>);
+      static_assert(
+          std::is_invocable_v<decltype(compact), SingleLinkedList<int> &>);
+      const int allocations_before = allocations;
+      Small list(&upstream);
+      list.Assign({4, 3, 2, 1});
+      assert(list.GetInlineCount() == 4u);
+      list.Sort();
+      list.EraseAfter(list.before_begin());
+      list.PushBack(5);
+      assert((list == Small{2, 3, 4, 5}));
+      assert(allocations == allocations_before);
+      assert(list.GetInlineCount() == 4u);
+    }
+  }
+
+  // Копии и перемещения размещают узлы в собственных ячейках
+  {
+    SmallSingleLinkedList<int> list{1, 2, 3};
+    assert(list.GetInlineCount() == 3u);
+    SmallSingleLinkedList<int> copy = list;
+    assert(copy == list);
+    assert(copy.GetInlineCount() == 3u);
+
+    SmallSingleLinkedList<int> moved(std::move(copy));
+    assert(copy.IsEmpty());
+    assert(copy.GetInlineCount() == 0u);
+    assert(moved == list);
+    moved.PushBack(4);
+    list = moved;
+    assert(list.GetSize() == 4u && list.GetInlineCount() == 4u);
+    list = SmallSingleLinkedList<int>{7};
+    assert((list == SmallSingleLinkedList<int>{7}));
+    assert(list.GetInlineCount() == 1u);
+    list.Sort();
+    assert(list < moved || moved < list);
+  }
+
+  // Узлы из ячеек списка нельзя передать другому списку
+  {
+    using Small = SmallSingleLinkedList<int>;
+    static_assert(
+        !std::is_convertible_v<Small &, ::pmr::SingleLinkedList<int> &>);
+    static_assert(
+        !std::is_constructible_v<::pmr::SingleLinkedList<int>, Small &&>);
+    Small list{3, 1, 3, 3, 2};
+    assert(list.Remove(1) == 1u);
+    assert(list.Unique() == 2u);
+    assert(list.RemoveIf([](int value) { return value == 2; }) == 1u);
+    assert(list.EraseAfter(list.before_begin(), list.end()) == 1u);
+    assert(list.IsEmpty());
+  }
+}
+
+void Test30() {
+  SingleLinkedList<int> list;
+  list.ForEach([](int &) { assert(false); });
+  for (int i = 1; i <= 100; ++i) {
+    list.PushBack(i);
+  }
+  int sum = 0;
+  std::as_const(list).ForEach([&sum](const int &value) { sum += value; });
+  assert(sum == 5050);
+  list.ForEach([](int &value) { value *= 2; });
+  assert(*list.begin() == 2);
+
+  // Обходы через итераторы и ForEach совпадают при любой настройке
+  // упреждающей загрузки
+  SingleLinkedList<std::string> words{"a", "b", "c"};
+  std::string joined;
+  words.ForEach([&joined](const std::string &word) { joined += word; });
+  assert(joined == "abc");
+  auto copy = words;
+  assert(copy == words);
+  copy.Clear();
+  assert(copy.IsEmpty() && !words.IsEmpty());
+}
+
+void Test31() {
+  // Монотонный ресурс выдаёт узлы подряд, поэтому список, заполненный с
+  // начала, обходится от старших адресов к младшим, а после Compact — подряд
+  {
+    std::array<std::byte, 8192> buffer;
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+    ::pmr::SingleLinkedList<int> list(&resource);
+    for (int i = 100; i >= 1; --i) {
+      list.PushFront(i);
+    }
+    ListLocality locality = list.MeasureLocality();
+    assert(locality.links == 99u);
+    assert(locality.near_links == 0u);
+
+    list.Compact();
+    locality = list.MeasureLocality();
+    assert(locality.links == 99u && locality.near_links == 99u);
+    assert(locality.GetNearFraction() == 1.0);
+    assert(list.GetSize() == 100u && list.GetCapacity() == 100u);
+    int expected = 1;
+    for (int value : list) {
+      assert(value == expected++);
+    }
+    list.PushBack(101);
+    assert(list.GetSize() == 101u);
+
+    if constexpr (kListStatsEnabled) {
+      const ListStats stats = list.GetStats();
+      assert(stats.relocated_nodes == 100u);
+      assert(stats.relayout_before.links == 99u);
+      assert(stats.relayout_before.near_links == 0u);
+      assert(stats.relayout_after.near_links == 99u);
+    }
+  }
+
+  // Постепенный проход ограниченными шагами, между которыми список
+  // изменяется
+  {
+    int allocations = 0;
+    int deallocations = 0;
+    using List = SingleLinkedList<int, CountingAllocator<int>>;
+    List list{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+              CountingAllocator<int>(&allocations, &deallocations)};
+    list.Reserve(12);
+    assert(allocations == 12);
+
+    size_t steps = 0;
+    auto pos = list.CompactAfter(list.cbefore_begin(), 3);
+    for (; pos != list.end(); pos = list.CompactAfter(pos, 3)) {
+      if (++steps == 1) {
+        assert(*pos == 2);
+        list.EraseAfter(pos);
+        list.PushFront(-1);
+      }
+    }
+    assert(steps == 2u);
+    // Прежние узлы остались в запасе и заняты вставкой
+    assert(allocations == 21 && deallocations == 1);
+    assert(list.GetCapacity() == 20u);
+    assert((list == List{{-1, 0, 1, 2, 4, 5, 6, 7, 8, 9},
+                         list.get_allocator()}));
+    list.ShrinkToFit();
+    assert(list.GetCapacity() == 10u);
+    assert(allocations - deallocations == 10);
+
+    // Запас, созданный Reserve, переживает Compact
+    list.Reserve(16);
+    list.Compact();
+    assert(list.GetCapacity() == 16u);
+    assert(allocations - deallocations == 16);
+    list.PushBack(10);
+    assert(list.GetSize() == 11u);
+  }
+
+  // Шаг без узлов после pos и шаг нулевой длины
+  {
+    SingleLinkedList<int> empty;
+    empty.Compact();
+    assert(empty.CompactAfter(empty.cbefore_begin(), 4) == empty.end());
+    SingleLinkedList<int> list{1, 2};
+    assert(list.CompactAfter(list.cbefore_begin(), 0) == list.before_begin());
+    assert(list.CompactAfter(list.cbegin(), 10) == list.end());
+    assert((list == SingleLinkedList<int>{1, 2}));
+  }
+
+  // Значение с выбрасывающим перемещением копируется, и исключение при
+  // копировании оставляет все элементы списка на месте
+  {
+    struct ThrowOnCopy {
+      explicit ThrowOnCopy(int v) : value(v) {}
+      ThrowOnCopy(const ThrowOnCopy &other) : value(other.value) {
+        if (value < 0) {
+          throw std::runtime_error("copy");
+        }
+      }
+      ThrowOnCopy(ThrowOnCopy &&other) : value(other.value) {}
+      int value;
+    };
+    SingleLinkedList<ThrowOnCopy> list;
+    for (int value : {3, -2, 1}) {
+      list.EmplaceFront(value);
+    }
+    try {
+      list.Compact();
+      assert(false);
+    } catch (const std::runtime_error &) {
+    }
+    std::vector<int> values;
+    for (const ThrowOnCopy &item : list) {
+      values.push_back(item.value);
+    }
+    assert((values == std::vector<int>{1, -2, 3}));
+    assert(list.GetCapacity() == 3u);
+
+    std::next(list.begin())->value = 2;
+    list.Compact();
+    values.clear();
+    for (const ThrowOnCopy &item : list) {
+      values.push_back(item.value);
+    }
+    assert((values == std::vector<int>{1, 2, 3}));
+  }
+}
+
+void Test32() {
+  // Элементы разрушаются в потоке освобождения, а список сразу пустеет
+  struct ThreadSpy {
+    explicit ThreadSpy(std::atomic<int> *counter) noexcept
+        : destroyed(counter) {}
+    ThreadSpy(const ThreadSpy &) = default;
+    ~ThreadSpy() {
+      if (std::this_thread::get_id() != owner) {
+        destroyed->fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    std::atomic<int> *destroyed;
+    std::thread::id owner = std::this_thread::get_id();
+  };
+
+  std::atomic<int> destroyed{0};
+  {
+    ListReclaimer reclaimer;
+    SingleLinkedList<ThreadSpy> list;
+    for (int i = 0; i < 1000; ++i) {
+      list.EmplaceFront(&destroyed);
+    }
+    list.Reserve(1010);
+    reclaimer.ReleaseAsync(list);
+    assert(list.IsEmpty() && list.GetCapacity() == 0u);
+    // Список пригоден к использованию после передачи
+    list.EmplaceFront(&destroyed);
+    reclaimer.ReleaseAsync(std::move(list));
+
+    SingleLinkedList<int> empty;
+    reclaimer.ReleaseAsync(empty);
+    reclaimer.Drain();
+    assert(destroyed == 1001);
+    ReclaimerStats stats = reclaimer.GetStats();
+    assert(stats.queued_lists == 2u && stats.reclaimed_lists == 2u);
+    assert(stats.queued_nodes == 1011u && stats.reclaimed_nodes == 1011u);
+    assert(reclaimer.GetPendingNodes() == 0u);
+
+    // Списки, переданные из нескольких потоков
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&reclaimer] {
+        for (int i = 0; i < 50; ++i) {
+          reclaimer.ReleaseAsync(SingleLinkedList<int>{1, 2, 3, 4});
+        }
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    reclaimer.Drain();
+    stats = reclaimer.GetStats();
+    assert(stats.reclaimed_lists == 202u);
+    assert(stats.reclaimed_nodes == 1011u + 800u);
+
+    // Деструктор дожидается списков, переданных без Drain
+    SingleLinkedList<ThreadSpy> last;
+    last.EmplaceFront(&destroyed);
+    reclaimer.ReleaseAsync(last);
+  }
+  assert(destroyed == 1002);
+}
+
 int main() {
   Test0();
   Test1();
   Test2();
   Test3();
   Test4();
+  Test5();
+  Test6();
+  Test7();
+  Test8();
+  Test9();
+  Test10();
+  Test11();
+  Test12();
+  Test13();
+  Test14();
+  Test15();
+  Test16();
+  Test17();
+  Test18();
+  Test19();
+  Test20();
+  Test21();
+  Test22();
+  Test23();
+  Test24();
+  Test25();
+  Test26();
+  Test27();
+  Test28();
+  Test29();
+  Test30();
+  Test31();
+  Test32();
 }
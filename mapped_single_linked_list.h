@@ -0,0 +1,156 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "list_serialization.h"
+
+/*
+ * Представление только для чтения списка, записанного SerializeList в файл
+ * Файл отображается в память (POSIX mmap), и элементы читаются прямо из
+ * отображения: узлы не создаются, а открытие не зависит от длины списка.
+ * Страницы файла загружаются операционной системой при первом обращении
+ * Итераторы однонаправленного обхода — указатели на элементы, поэтому
+ * представление подходит для алгоритмов над списками, использующих
+ * GetSize, begin и end
+ * Итераторы и ссылки на элементы действительны, пока существует
+ * представление. Изменение файла другим процессом во время отображения
+ * приводит к неопределённому поведению
+ */
+template <typename Type>
+class MappedSingleLinkedList {
+ public:
+  using value_type = Type;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using ConstIterator = const Type *;
+  using Iterator = ConstIterator;
+
+  // Отображает файл path. Выбрасывает std::system_error, если файл не
+  // удалось открыть или отобразить, и std::runtime_error, если файл не
+  // содержит список элементов типа Type
+  explicit MappedSingleLinkedList(const std::string &path) {
+    detail::RequireSerializable<Type>();
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), "open " + path);
+    }
+    try {
+      Map(fd);
+    } catch (...) {
+      ::close(fd);
+      throw;
+    }
+    // Отображение остаётся действительным после закрытия файла
+    ::close(fd);
+  }
+
+  MappedSingleLinkedList(const MappedSingleLinkedList &) = delete;
+  MappedSingleLinkedList &operator=(const MappedSingleLinkedList &) = delete;
+
+  MappedSingleLinkedList(MappedSingleLinkedList &&other) noexcept
+      : mapping_(std::exchange(other.mapping_, nullptr)),
+        mapping_size_(std::exchange(other.mapping_size_, 0)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  MappedSingleLinkedList &operator=(MappedSingleLinkedList &&rhs) noexcept {
+    if (this != &rhs) {
+      Unmap();
+      mapping_ = std::exchange(rhs.mapping_, nullptr);
+      mapping_size_ = std::exchange(rhs.mapping_size_, 0);
+      size_ = std::exchange(rhs.size_, 0);
+    }
+    return *this;
+  }
+
+  ~MappedSingleLinkedList() { Unmap(); }
+
+  [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] ConstIterator begin() const noexcept { return GetData(); }
+  [[nodiscard]] ConstIterator end() const noexcept {
+    return GetData() + size_;
+  }
+  [[nodiscard]] ConstIterator cbegin() const noexcept { return begin(); }
+  [[nodiscard]] ConstIterator cend() const noexcept { return end(); }
+
+ private:
+  const Type *GetData() const noexcept {
+    return mapping_ == nullptr
+               ? nullptr
+               : reinterpret_cast<const Type *>(
+                     static_cast<const unsigned char *>(mapping_) +
+                     kListFileDataOffset);
+  }
+
+  void Map(int fd) {
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      throw std::system_error(errno, std::generic_category(), "fstat");
+    }
+    const auto file_size = static_cast<uint64_t>(info.st_size);
+    if (file_size < kListFileDataOffset) {
+      throw std::runtime_error("List file is truncated");
+    }
+    void *mapping = ::mmap(nullptr, static_cast<size_t>(file_size), PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category(), "mmap");
+    }
+    mapping_ = mapping;
+    mapping_size_ = static_cast<size_t>(file_size);
+    try {
+      ListFileHeader header;
+      std::memcpy(&header, mapping, sizeof(header));
+      detail::ValidateListFileHeader<Type>(header);
+      if (header.element_count >
+          (file_size - kListFileDataOffset) / sizeof(Type)) {
+        throw std::runtime_error("List data is truncated");
+      }
+      size_ = static_cast<size_t>(header.element_count);
+    } catch (...) {
+      Unmap();
+      throw;
+    }
+  }
+
+  void Unmap() noexcept {
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, mapping_size_);
+      mapping_ = nullptr;
+      mapping_size_ = 0;
+      size_ = 0;
+    }
+  }
+
+  void *mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  size_t size_ = 0;
+};
+
+template <typename Type>
+bool operator==(const MappedSingleLinkedList<Type> &lhs,
+                const MappedSingleLinkedList<Type> &rhs) {
+  return lhs.GetSize() == rhs.GetSize() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type>
+bool operator!=(const MappedSingleLinkedList<Type> &lhs,
+                const MappedSingleLinkedList<Type> &rhs) {
+  return !(lhs == rhs);
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+/*
+ * Пул ячеек фиксированного размера для узлов списка
+ * Ячейки нарезаются из непрерывных блоков, запрошенных у вышестоящего ресурса,
+ * а освобождённые ячейки возвращаются в список свободных и переиспользуются
+ * Размер ячейки определяется первым запросом на выделение памяти — для
+ * pmr::SingleLinkedList это размер узла. Запросы большего размера или с более
+ * строгим выравниванием передаются вышестоящему ресурсу
+ * Пул не синхронизирован: для многопоточной работы каждому потоку следует
+ * использовать собственный пул
+ */
+class NodePoolResource : public std::pmr::memory_resource {
+ public:
+  explicit NodePoolResource(
+      size_t nodes_per_block = 256,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : nodes_per_block_(std::max<size_t>(nodes_per_block, 1)),
+        upstream_(upstream) {}
+
+  NodePoolResource(const NodePoolResource &) = delete;
+  NodePoolResource &operator=(const NodePoolResource &) = delete;
+
+  ~NodePoolResource() override { Release(); }
+
+  // Возвращает все блоки вышестоящему ресурсу. Память, выделенная из пула,
+  // становится недействительной
+  void Release() noexcept {
+    while (blocks_ != nullptr) {
+      BlockHeader *block = blocks_;
+      blocks_ = block->next;
+      upstream_->deallocate(block, block_bytes_, slot_alignment_);
+    }
+    free_slots_ = nullptr;
+    unused_begin_ = nullptr;
+    unused_end_ = nullptr;
+    block_count_ = 0;
+  }
+
+  // Возвращает количество блоков, полученных от вышестоящего ресурса
+  [[nodiscard]] size_t GetBlockCount() const noexcept { return block_count_; }
+
+  // Возвращает размер ячейки пула или 0, если пул ещё не использовался
+  [[nodiscard]] size_t GetSlotSize() const noexcept { return slot_size_; }
+
+  [[nodiscard]] std::pmr::memory_resource *GetUpstream() const noexcept {
+    return upstream_;
+  }
+
+ private:
+  // Заголовок блока. Занимает первую ячейку блока
+  struct BlockHeader {
+    BlockHeader *next;
+  };
+
+  // Свободная ячейка хранит указатель на следующую свободную ячейку
+  struct FreeSlot {
+    FreeSlot *next;
+  };
+
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    if (slot_size_ == 0) {
+      slot_alignment_ = std::max({alignment, alignof(FreeSlot),
+                                  alignof(BlockHeader)});
+      slot_size_ = RoundUp(std::max({bytes, sizeof(FreeSlot),
+                                     sizeof(BlockHeader)}),
+                           slot_alignment_);
+      block_bytes_ = slot_size_ * (nodes_per_block_ + 1);
+    }
+    if (!FitsSlot(bytes, alignment)) {
+      return upstream_->allocate(bytes, alignment);
+    }
+    if (free_slots_ != nullptr) {
+      FreeSlot *slot = free_slots_;
+      free_slots_ = slot->next;
+      return slot;
+    }
+    if (unused_begin_ == unused_end_) {
+      AllocateBlock();
+    }
+    void *slot = unused_begin_;
+    unused_begin_ += slot_size_;
+    return slot;
+  }
+
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+    if (!FitsSlot(bytes, alignment)) {
+      upstream_->deallocate(p, bytes, alignment);
+      return;
+    }
+    free_slots_ = ::new (p) FreeSlot{free_slots_};
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  bool FitsSlot(size_t bytes, size_t alignment) const noexcept {
+    return bytes <= slot_size_ && alignment <= slot_alignment_;
+  }
+
+  void AllocateBlock() {
+    auto *block = static_cast<std::byte *>(
+        upstream_->allocate(block_bytes_, slot_alignment_));
+    blocks_ = ::new (block) BlockHeader{blocks_};
+    ++block_count_;
+    unused_begin_ = block + slot_size_;
+    unused_end_ = block + block_bytes_;
+  }
+
+  static size_t RoundUp(size_t value, size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+  }
+
+  size_t nodes_per_block_;
+  std::pmr::memory_resource *upstream_;
+  size_t slot_size_ = 0;
+  size_t slot_alignment_ = 0;
+  size_t block_bytes_ = 0;
+  size_t block_count_ = 0;
+  BlockHeader *blocks_ = nullptr;
+  FreeSlot *free_slots_ = nullptr;
+  // Ещё не выданная часть последнего блока
+  std::byte *unused_begin_ = nullptr;
+  std::byte *unused_end_ = nullptr;
+};
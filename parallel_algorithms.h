@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "list_compare.h"
+
+/*
+ * Параметры параллельного выполнения алгоритмов над списками
+ * thread_count — наибольшее количество потоков, включая вызывающий. Значение
+ * 0 означает количество аппаратных потоков
+ * min_segment_size — наименьшее количество элементов на один поток. Для
+ * коротких списков создание потоков обходится дороже самого обхода
+ */
+struct ParallelPolicy {
+  size_t thread_count = 0;
+  size_t min_segment_size = 16384;
+};
+
+// Политика по умолчанию: все аппаратные потоки
+inline constexpr ParallelPolicy kParallel{};
+
+// Политика последовательного выполнения в вызывающем потоке
+inline constexpr ParallelPolicy kSequential{1, 1};
+
+namespace detail {
+
+// Возвращает количество сегментов, на которые следует разбить size элементов
+inline size_t CountSegments(const ParallelPolicy &policy, size_t size) {
+  size_t threads = policy.thread_count;
+  if (threads == 0) {
+    threads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  const size_t by_size = size / std::max<size_t>(policy.min_segment_size, 1);
+  return std::max<size_t>(std::min(threads, by_size), 1);
+}
+
+/*
+ * Разбивает size элементов, начиная с firsts, на сегменты равной длины и
+ * вызывает process(index, offset, length, begins...) для каждого сегмента,
+ * где offset — номер первого элемента сегмента, а begins — итераторы на него
+ * Если передано несколько итераторов, все они продвигаются одновременно, что
+ * позволяет разбить несколько последовательностей в одних и тех же позициях
+ * Точки разбиения находятся за один проход: поток для очередного сегмента
+ * запускается, как только проход достигает его начала, поэтому поиск точек
+ * разбиения выполняется одновременно с обработкой уже найденных сегментов.
+ * Последний сегмент обрабатывается вызывающим потоком
+ * Возвращает количество сегментов. Исключение из process будет выброшено
+ * повторно после завершения всех потоков; если исключения выбросили
+ * несколько сегментов, выбрасывается исключение сегмента с меньшим номером
+ */
+template <typename Process, typename... Iterators>
+size_t ForEachSegment(const ParallelPolicy &policy, size_t size,
+                      Process &process, Iterators... firsts) {
+  const size_t segment_count = CountSegments(policy, size);
+  if (segment_count == 1) {
+    process(size_t{0}, size_t{0}, size, firsts...);
+    return 1;
+  }
+
+  std::vector<std::exception_ptr> errors(segment_count);
+  std::vector<std::thread> workers;
+  workers.reserve(segment_count - 1);
+  auto run = [&process, &errors](size_t index, size_t offset, size_t length,
+                                 Iterators... begins) noexcept {
+    try {
+      process(index, offset, length, begins...);
+    } catch (...) {
+      errors[index] = std::current_exception();
+    }
+  };
+
+  const size_t base_length = size / segment_count;
+  const size_t extra = size % segment_count;
+  size_t offset = 0;
+  try {
+    for (size_t index = 0; index + 1 < segment_count; ++index) {
+      const size_t length = base_length + (index < extra ? 1 : 0);
+      workers.emplace_back(run, index, offset, length, firsts...);
+      (std::advance(firsts, length), ...);
+      offset += length;
+    }
+  } catch (...) {
+    // Не удалось запустить поток: дожидаемся уже запущенных
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    throw;
+  }
+  // Последний сегмент занимает остаток диапазона, поэтому итераторы за его
+  // конец не продвигаются
+  run(segment_count - 1, offset, size - offset, firsts...);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return segment_count;
+}
+
+}  // namespace detail
+
+// Вызывает func для каждого элемента container. Элементы разных сегментов
+// обрабатываются одновременно, поэтому func должна допускать вызов из
+// нескольких потоков
+template <typename Container, typename Function>
+void ParallelForEach(const ParallelPolicy &policy, Container &container,
+                     Function func) {
+  auto process = [&func](size_t, size_t, size_t length, auto it) {
+    for (; length > 0; --length, ++it) {
+      func(*it);
+    }
+  };
+  detail::ForEachSegment(policy, container.GetSize(), process,
+                         container.begin());
+}
+
+/*
+ * Сворачивает элементы container операцией op, начиная со значения init
+ * Каждый поток сворачивает свой сегмент, после чего результаты сегментов
+ * объединяются по порядку. Поэтому op должна быть ассоциативной, но может
+ * быть некоммутативной
+ */
+template <typename Container, typename Type, typename BinaryOperation>
+Type ParallelReduce(const ParallelPolicy &policy, const Container &container,
+                    Type init, BinaryOperation op) {
+  std::vector<std::optional<Type>> partials(
+      detail::CountSegments(policy, container.GetSize()));
+  auto process = [&op, &partials](size_t index, size_t, size_t length,
+                                  auto it) {
+    if (length == 0) {
+      return;
+    }
+    Type partial(*it);
+    for (--length, ++it; length > 0; --length, ++it) {
+      partial = op(std::move(partial), *it);
+    }
+    partials[index].emplace(std::move(partial));
+  };
+  detail::ForEachSegment(policy, container.GetSize(), process,
+                         container.begin());
+  for (auto &partial : partials) {
+    if (partial) {
+      init = op(std::move(init), std::move(*partial));
+    }
+  }
+  return init;
+}
+
+template <typename Container, typename Type>
+Type ParallelReduce(const ParallelPolicy &policy, const Container &container,
+                    Type init) {
+  return ParallelReduce(policy, container, std::move(init), std::plus<>());
+}
+
+// Возвращает количество элементов container, для которых pred возвращает
+// true. pred должен допускать вызов из нескольких потоков
+template <typename Container, typename Predicate>
+size_t ParallelCountIf(const ParallelPolicy &policy, const Container &container,
+                       Predicate pred) {
+  std::vector<size_t> counts(
+      detail::CountSegments(policy, container.GetSize()));
+  auto process = [&pred, &counts](size_t index, size_t, size_t length,
+                                  auto it) {
+    for (; length > 0; --length, ++it) {
+      if (pred(*it)) {
+        ++counts[index];
+      }
+    }
+  };
+  detail::ForEachSegment(policy, container.GetSize(), process,
+                         container.begin());
+  size_t total = 0;
+  for (size_t count : counts) {
+    total += count;
+  }
+  return total;
+}
+
+namespace detail {
+
+// Количество элементов, после обработки которых сегмент проверяет, не найдено
+// ли различие в сегменте с меньшим номером
+inline constexpr size_t kMismatchCheckInterval = 1024;
+
+// Первая пара различающихся элементов
+struct FirstMismatch {
+  // Позиция пары или длина сравниваемого диапазона, если различий нет
+  size_t position = 0;
+  // Ненулевой результат классификатора для этой пары
+  int order = 0;
+};
+
+/*
+ * Находит наименьшую позицию среди первых size элементов lhs и rhs, для
+ * которой classify(lhs_element, rhs_element) возвращает ненулевое значение
+ * Сегменты сравниваются одновременно. Каждый сегмент останавливается на своём
+ * первом различии, а также прекращает работу, как только различие найдено в
+ * предшествующей ему части, так как его результат уже не может оказаться
+ * первым
+ */
+template <typename Iterator1, typename Iterator2, typename Classify>
+FirstMismatch FindFirstMismatch(const ParallelPolicy &policy, size_t size,
+                                Iterator1 lhs, Iterator2 rhs,
+                                Classify classify) {
+  std::atomic<size_t> found{size};
+  std::vector<FirstMismatch> mismatches(CountSegments(policy, size),
+                                        FirstMismatch{size, 0});
+  auto process = [&found, &mismatches, &classify](
+                     size_t index, size_t offset, size_t length, auto lhs_it,
+                     auto rhs_it) {
+    const size_t end = offset + length;
+    for (size_t position = offset; position < end;
+         ++position, ++lhs_it, ++rhs_it) {
+      if ((position - offset) % kMismatchCheckInterval == 0 &&
+          found.load(std::memory_order_relaxed) < position) {
+        return;
+      }
+      if (const int order = classify(*lhs_it, *rhs_it); order != 0) {
+        mismatches[index] = {position, order};
+        size_t current = found.load(std::memory_order_relaxed);
+        while (position < current &&
+               !found.compare_exchange_weak(current, position,
+                                            std::memory_order_relaxed)) {
+        }
+        return;
+      }
+    }
+  };
+  ForEachSegment(policy, size, process, lhs, rhs);
+  // Сегменты упорядочены по позициям, поэтому первое различие принадлежит
+  // первому сегменту, в котором оно найдено
+  for (const FirstMismatch &mismatch : mismatches) {
+    if (mismatch.order != 0) {
+      return mismatch;
+    }
+  }
+  return {size, 0};
+}
+
+}  // namespace detail
+
+// Возвращает позицию первой пары неравных элементов lhs и rhs или длину
+// более короткого контейнера, если такой пары нет
+template <typename Container1, typename Container2>
+size_t ParallelMismatch(const ParallelPolicy &policy, const Container1 &lhs,
+                        const Container2 &rhs) {
+  return detail::FindFirstMismatch(
+             policy, std::min(lhs.GetSize(), rhs.GetSize()), lhs.begin(),
+             rhs.begin(),
+             [](const auto &l, const auto &r) { return l == r ? 0 : 1; })
+      .position;
+}
+
+// Параллельный аналог operator==. Контейнеры разной длины сравниваются за
+// O(1)
+template <typename Container1, typename Container2>
+bool ParallelEqual(const ParallelPolicy &policy, const Container1 &lhs,
+                   const Container2 &rhs) {
+  return lhs.GetSize() == rhs.GetSize() &&
+         ParallelMismatch(policy, lhs, rhs) == lhs.GetSize();
+}
+
+// Результат параллельного лексикографического сравнения
+struct ParallelCompareResult {
+  detail::ThreeWayResult result;
+  // Позиция первой пары элементов, определившей порядок, или длина более
+  // короткого контейнера, если порядок определила длина
+  size_t mismatch = 0;
+};
+
+/*
+ * Параллельный аналог CompareThreeWay с тем же результатом: сравнение
+ * выполняется за один проход, и для равных элементов выполняется
+ * единственное сравнение ==
+ * Дополнительно сообщает позицию первой пары элементов, определившей порядок
+ */
+template <typename Container1, typename Container2>
+ParallelCompareResult ParallelCompareThreeWay(const ParallelPolicy &policy,
+                                              const Container1 &lhs,
+                                              const Container2 &rhs) {
+  const size_t common = std::min(lhs.GetSize(), rhs.GetSize());
+  // Найдены эквивалентные, но не равные элементы
+  std::atomic<bool> unequal{false};
+  const detail::FirstMismatch mismatch = detail::FindFirstMismatch(
+      policy, common, lhs.begin(), rhs.begin(),
+      [&unequal](const auto &l, const auto &r) {
+        if (l == r) {
+          return 0;
+        }
+        if (l < r) {
+          return -1;
+        }
+        if (r < l) {
+          return 1;
+        }
+        unequal.store(true, std::memory_order_relaxed);
+        return 0;
+      });
+
+  ParallelCompareResult compare{{mismatch.order, false}, mismatch.position};
+  if (mismatch.order == 0 && lhs.GetSize() != rhs.GetSize()) {
+    compare.result.order = lhs.GetSize() < rhs.GetSize() ? -1 : 1;
+  } else if (mismatch.order == 0) {
+    compare.result.equal = !unequal.load(std::memory_order_relaxed);
+  }
+  return compare;
+}
+
+template <typename Container1, typename Container2>
+bool ParallelLess(const ParallelPolicy &policy, const Container1 &lhs,
+                  const Container2 &rhs) {
+  return detail::IsLess(ParallelCompareThreeWay(policy, lhs, rhs).result);
+}
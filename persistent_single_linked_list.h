@@ -0,0 +1,482 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "list_compare.h"
+
+/*
+ * Односвязный список, копии которого разделяют узлы
+ * Узлы снабжены счётчиком ссылок, поэтому копирование выполняется за O(1) и
+ * не выделяет памяти: копия ссылается на ту же цепочку узлов. Изменение
+ * списка не затрагивает его копии. PushFront и PopFront выполняются за O(1)
+ * без копирования узлов, а InsertAfter и EraseAfter копируют только те узлы
+ * от начала списка до места изменения, которые используются другими
+ * списками (копирование пути). Узлы, принадлежащие только этому списку,
+ * изменяются на месте
+ * Так как элементы разделяются между копиями, они доступны только для
+ * чтения. Чтобы изменить элемент, его следует удалить и вставить заново
+ * Списки, разделяющие узлы, можно использовать из разных потоков, в том числе
+ * разрушать. Одновременная работа с одним и тем же объектом списка должна
+ * синхронизироваться вызывающим кодом
+ * Узлы разделяются только списками с равными аллокаторами, иначе копия
+ * получает собственные узлы
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class PersistentSingleLinkedList {
+  struct Node;
+
+  struct NodeBase {
+    // Владеющая ссылка на следующий узел
+    Node *next_node = nullptr;
+  };
+
+  struct Node : NodeBase {
+    template <typename... Args>
+    explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    // Количество владеющих ссылок: из предыдущих узлов и из списков,
+    // начинающихся с этого узла
+    std::atomic<size_t> references{1};
+    const Type value;
+  };
+
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+
+  // Итератор на элементы списка. Элементы могут разделяться с другими
+  // списками, поэтому доступны только для чтения
+  class ConstIterator {
+    friend class PersistentSingleLinkedList;
+
+    explicit ConstIterator(const NodeBase *node) noexcept : node_(node) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type *;
+    using reference = const Type &;
+
+    ConstIterator() = default;
+
+    [[nodiscard]] bool operator==(const ConstIterator &rhs) const noexcept {
+      return node_ == rhs.node_;
+    }
+
+    [[nodiscard]] bool operator!=(const ConstIterator &rhs) const noexcept {
+      return node_ != rhs.node_;
+    }
+
+    ConstIterator &operator++() noexcept {
+      assert(node_ != nullptr);
+      node_ = node_->next_node;
+      return *this;
+    }
+
+    ConstIterator operator++(int) noexcept {
+      auto old_value(*this);
+      ++(*this);
+      return old_value;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+      assert(node_ != nullptr);
+      return static_cast<const Node *>(node_)->value;
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+      assert(node_ != nullptr);
+      return &static_cast<const Node *>(node_)->value;
+    }
+
+   private:
+    const NodeBase *node_ = nullptr;
+  };
+
+  using Iterator = ConstIterator;
+
+  PersistentSingleLinkedList() = default;
+
+  explicit PersistentSingleLinkedList(const Allocator &alloc) : alloc_(alloc) {}
+
+  PersistentSingleLinkedList(std::initializer_list<Type> values,
+                             const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    AppendCopies(values.begin(), values.end());
+  }
+
+  // Разделяет узлы other за O(1). Если аллокатор копии не равен аллокатору
+  // other, элементы копируются
+  PersistentSingleLinkedList(const PersistentSingleLinkedList &other)
+      : PersistentSingleLinkedList(
+            other, NodeTraits::select_on_container_copy_construction(
+                       other.alloc_)) {}
+
+  PersistentSingleLinkedList(const PersistentSingleLinkedList &other,
+                             const Allocator &alloc)
+      : alloc_(alloc) {
+    if (alloc_ == other.alloc_) {
+      Share(other);
+    } else {
+      AppendCopies(other.begin(), other.end());
+    }
+  }
+
+  PersistentSingleLinkedList(PersistentSingleLinkedList &&other) noexcept
+      : alloc_(other.alloc_) {
+    SwapNodes(other);
+  }
+
+  PersistentSingleLinkedList &operator=(const PersistentSingleLinkedList &rhs) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+      if (alloc_ != rhs.alloc_) {
+        Clear();
+        alloc_ = rhs.alloc_;
+      }
+    }
+    if (alloc_ == rhs.alloc_) {
+      // Ссылка на новые узлы берётся до освобождения старых, так как цепочки
+      // могут пересекаться
+      Node *old = head_.next_node;
+      Share(rhs);
+      ReleaseChain(old);
+    } else {
+      PersistentSingleLinkedList copy(rhs, allocator_type(alloc_));
+      SwapNodes(copy);
+    }
+    return *this;
+  }
+
+  // Если аллокатор не распространяется при перемещении и аллокаторы списков
+  // не равны, элементы rhs копируются: узлы неизменяемы и могут разделяться
+  // с другими списками
+  PersistentSingleLinkedList &operator=(
+      PersistentSingleLinkedList &&rhs) noexcept(
+      NodeTraits::propagate_on_container_move_assignment::value ||
+      NodeTraits::is_always_equal::value) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+      Clear();
+      alloc_ = rhs.alloc_;
+      SwapNodes(rhs);
+    } else {
+      if (alloc_ == rhs.alloc_) {
+        Clear();
+        SwapNodes(rhs);
+      } else {
+        PersistentSingleLinkedList copy(rhs, allocator_type(alloc_));
+        SwapNodes(copy);
+        rhs.Clear();
+      }
+    }
+    return *this;
+  }
+
+  // Узлы, которыми владеет только этот список, освобождаются по одному,
+  // поэтому длинная цепочка не разрушается рекурсивно
+  ~PersistentSingleLinkedList() { Clear(); }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return ConstIterator(&head_);
+  }
+
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return before_begin();
+  }
+
+  [[nodiscard]] ConstIterator begin() const noexcept {
+    return ConstIterator(head_.next_node);
+  }
+
+  [[nodiscard]] ConstIterator cbegin() const noexcept { return begin(); }
+
+  [[nodiscard]] ConstIterator end() const noexcept { return ConstIterator(); }
+
+  [[nodiscard]] ConstIterator cend() const noexcept { return end(); }
+
+  void PushFront(const Type &value) { EmplaceFront(value); }
+
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  // Добавляет элемент в начало за O(1). Узлы, разделяемые с копиями, не
+  // копируются: новый узел ссылается на прежнее начало списка
+  template <typename... Args>
+  const Type &EmplaceFront(Args &&...args) {
+    Node *node = CreateNode(std::forward<Args>(args)...);
+    node->next_node = head_.next_node;
+    head_.next_node = node;
+    ++size_;
+    return node->value;
+  }
+
+  // Удаляет первый элемент за O(1). Если узел разделяется с копиями, он
+  // остаётся в них
+  void PopFront() noexcept {
+    assert(!IsEmpty());
+    Node *first = head_.next_node;
+    head_.next_node = Retain(first->next_node);
+    --size_;
+    ReleaseChain(first);
+  }
+
+  ConstIterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  ConstIterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  /*
+   * Конструирует элемент после pos и возвращает итератор на него
+   * Узлы от начала списка до pos включительно, разделяемые с копиями,
+   * заменяются собственными копиями, поэтому вставка выполняется за время,
+   * пропорциональное расстоянию до pos. Итераторы на заменённые узлы, включая
+   * pos, становятся недействительными
+   * Исключение при конструировании или копировании элементов оставляет
+   * список без изменений
+   */
+  template <typename... Args>
+  ConstIterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    // Элемент конструируется первым, так как аргументы могут ссылаться на
+    // элементы списка
+    Node *node = CreateNode(std::forward<Args>(args)...);
+    NodeBase *prev;
+    try {
+      prev = MakeWritable(pos.node_);
+    } catch (...) {
+      DestroyNode(node);
+      throw;
+    }
+    node->next_node = prev->next_node;
+    prev->next_node = node;
+    ++size_;
+    return ConstIterator(node);
+  }
+
+  // Удаляет элемент, следующий за pos, и возвращает итератор на элемент,
+  // следовавший за удалённым. Разделяемые узлы до pos включительно копируются,
+  // как в EmplaceAfter
+  ConstIterator EraseAfter(ConstIterator pos) {
+    NodeBase *prev = MakeWritable(pos.node_);
+    Node *victim = prev->next_node;
+    assert(victim != nullptr);
+    prev->next_node = Retain(victim->next_node);
+    --size_;
+    ReleaseChain(victim);
+    return ConstIterator(prev->next_node);
+  }
+
+  void Clear() noexcept {
+    ReleaseChain(head_.next_node);
+    head_.next_node = nullptr;
+    size_ = 0;
+  }
+
+  void swap(PersistentSingleLinkedList &other) noexcept {
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc_, other.alloc_);
+    } else {
+      assert(alloc_ == other.alloc_);
+    }
+    SwapNodes(other);
+  }
+
+ private:
+  template <typename... Args>
+  Node *CreateNode(Args &&...args) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+    try {
+      NodeTraits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void DestroyNode(Node *node) noexcept {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+
+  static Node *Retain(Node *node) noexcept {
+    if (node != nullptr) {
+      node->references.fetch_add(1, std::memory_order_relaxed);
+    }
+    return node;
+  }
+
+  // Освобождает ссылку на node. Узлы, на которые больше нет ссылок,
+  // разрушаются вместе с их единственной ссылкой на следующий узел
+  void ReleaseChain(Node *node) noexcept {
+    while (node != nullptr &&
+           node->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      Node *next = node->next_node;
+      DestroyNode(node);
+      node = next;
+    }
+  }
+
+  // Узел принадлежит только этому списку, если на него одна ссылка и все
+  // предшествующие ему узлы также принадлежат только этому списку.
+  // Захватывающая загрузка синхронизируется с освобождением ссылок другими
+  // списками, поэтому их чтения узла завершены до его изменения
+  static bool IsExclusive(const Node *node) noexcept {
+    return node->references.load(std::memory_order_acquire) == 1;
+  }
+
+  /*
+   * Делает узлы от начала списка до target включительно принадлежащими
+   * только этому списку и возвращает узел, заменивший target
+   * Узлы общего начала изменяются на месте. С первого разделяемого узла
+   * строится цепочка копий до target, которая заменяет исходные узлы только
+   * после успешного копирования всех элементов
+   */
+  NodeBase *MakeWritable(const NodeBase *target) {
+    NodeBase *writable = &head_;
+    while (writable != target) {
+      assert(writable->next_node != nullptr);
+      if (!IsExclusive(writable->next_node)) {
+        break;
+      }
+      writable = writable->next_node;
+    }
+    if (writable == target) {
+      return writable;
+    }
+
+    const Node *source = writable->next_node;
+    Node *first = nullptr;
+    Node *last = nullptr;
+    try {
+      while (true) {
+        assert(source != nullptr);
+        Node *copy = CreateNode(source->value);
+        (last != nullptr ? last->next_node : first) = copy;
+        last = copy;
+        if (source == target) {
+          break;
+        }
+        source = source->next_node;
+      }
+    } catch (...) {
+      ReleaseChain(first);
+      throw;
+    }
+    last->next_node = Retain(source->next_node);
+    Node *replaced = writable->next_node;
+    writable->next_node = first;
+    ReleaseChain(replaced);
+    return last;
+  }
+
+  void Share(const PersistentSingleLinkedList &other) noexcept {
+    head_.next_node = Retain(other.head_.next_node);
+    size_ = other.size_;
+  }
+
+  template <typename InputIt>
+  void AppendCopies(InputIt first, InputIt last) {
+    NodeBase *tail = &head_;
+    try {
+      for (; first != last; ++first) {
+        tail->next_node = CreateNode(*first);
+        tail = tail->next_node;
+        ++size_;
+      }
+    } catch (...) {
+      Clear();
+      throw;
+    }
+  }
+
+  void SwapNodes(PersistentSingleLinkedList &other) noexcept {
+    std::swap(head_.next_node, other.head_.next_node);
+    std::swap(size_, other.size_);
+  }
+
+  NodeAllocator alloc_;
+  NodeBase head_;
+  size_t size_ = 0;
+};
+
+template <typename Type, typename Allocator>
+void swap(PersistentSingleLinkedList<Type, Allocator> &lhs,
+          PersistentSingleLinkedList<Type, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator==(const PersistentSingleLinkedList<Type, Allocator> &lhs,
+                const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetSize() == rhs.GetSize() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, typename Allocator>
+bool operator!=(const PersistentSingleLinkedList<Type, Allocator> &lhs,
+                const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator>
+detail::ThreeWayResult CompareThreeWay(
+    const PersistentSingleLinkedList<Type, Allocator> &lhs,
+    const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::CompareThreeWay(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename Type, typename Allocator>
+bool operator<(const PersistentSingleLinkedList<Type, Allocator> &lhs,
+               const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator<=(const PersistentSingleLinkedList<Type, Allocator> &lhs,
+                const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator>(const PersistentSingleLinkedList<Type, Allocator> &lhs,
+               const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator>=(const PersistentSingleLinkedList<Type, Allocator> &lhs,
+                const PersistentSingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}
@@ -0,0 +1,415 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "single_linked_list.h"
+
+/*
+ * Односвязный список с ускоренным доступом к элементу по номеру
+ * At и IteratorAt находят элемент от ближайшей предшествующей ему опорной
+ * точки — итератора с известным номером. Опорные точки расставляются через
+ * каждые kStride элементов при первом проходе по списку, а поиск ближайшей
+ * из них выполняется двоичным поиском, поэтому доступ к элементу занимает
+ * O(log(N / kStride) + kStride). Кроме того, запоминается последний
+ * найденный элемент, поэтому последовательное чтение окна элементов
+ * переходит к следующему элементу за O(1)
+ * Изменения поддерживают индекс без полного перестроения: вставка и удаление
+ * в начале сдвигают номера всех опорных точек за O(1), вставка в конец их не
+ * затрагивает, а вставка и удаление после элемента с известным номером —
+ * после begin, последнего найденного или последнего элемента — отбрасывают
+ * только опорные точки за местом изменения. Остальные изменения сбрасывают
+ * индекс, и он строится заново при следующем обращении
+ * Поиск элемента изменяет индекс, поэтому At и IteratorAt не являются
+ * константными
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class PositionalSingleLinkedList {
+  using List = SingleLinkedList<Type, Allocator>;
+  using AllocatorTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using Iterator = typename List::Iterator;
+  using ConstIterator = typename List::ConstIterator;
+
+  // Расстояние между соседними опорными точками индекса
+  static constexpr size_t kStride = 64;
+
+  PositionalSingleLinkedList() = default;
+
+  explicit PositionalSingleLinkedList(const Allocator &alloc)
+      : list_(alloc), checkpoints_(CheckpointAllocator(alloc)) {}
+
+  PositionalSingleLinkedList(std::initializer_list<Type> values,
+                             const Allocator &alloc = Allocator())
+      : list_(values, alloc), checkpoints_(CheckpointAllocator(alloc)) {}
+
+  // Индекс ссылается на узлы исходного списка, поэтому копия строит
+  // собственный индекс при первом обращении
+  PositionalSingleLinkedList(const PositionalSingleLinkedList &other)
+      : list_(other.list_),
+        checkpoints_(CheckpointAllocator(list_.get_allocator())) {}
+
+  PositionalSingleLinkedList &operator=(const PositionalSingleLinkedList &rhs) {
+    if (this != &rhs) {
+      list_ = rhs.list_;
+      ResetIndex();
+    }
+    return *this;
+  }
+
+  // Узлы переходят в новый список, поэтому индекс остаётся действительным
+  PositionalSingleLinkedList(PositionalSingleLinkedList &&other) noexcept
+      : list_(std::move(other.list_)),
+        checkpoints_(std::move(other.checkpoints_)),
+        first_checkpoint_(other.first_checkpoint_),
+        shift_(other.shift_),
+        cursor_(other.cursor_) {
+    other.ResetIndex();
+  }
+
+  // Перемещение узлов, в том числе выбор между переносом узлов и
+  // поэлементным перемещением, выполняет SingleLinkedList. Индекс rhs
+  // остаётся действительным, только если узлы перешли в этот список
+  PositionalSingleLinkedList &operator=(
+      PositionalSingleLinkedList &&rhs) noexcept(
+      AllocatorTraits::propagate_on_container_move_assignment::value ||
+      AllocatorTraits::is_always_equal::value) {
+    if (this == &rhs) {
+      return *this;
+    }
+    const bool moves_nodes =
+        AllocatorTraits::propagate_on_container_move_assignment::value ||
+        list_.get_allocator() == rhs.list_.get_allocator();
+    list_ = std::move(rhs.list_);
+    if (moves_nodes) {
+      checkpoints_ = std::move(rhs.checkpoints_);
+      first_checkpoint_ = rhs.first_checkpoint_;
+      shift_ = rhs.shift_;
+      cursor_ = rhs.cursor_;
+    } else {
+      ResetIndex();
+    }
+    rhs.ResetIndex();
+    return *this;
+  }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return list_.get_allocator();
+  }
+
+  [[nodiscard]] const List &GetList() const noexcept { return list_; }
+
+  [[nodiscard]] size_t GetSize() const noexcept { return list_.GetSize(); }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return list_.IsEmpty(); }
+
+  [[nodiscard]] Iterator begin() noexcept { return list_.begin(); }
+  [[nodiscard]] Iterator end() noexcept { return list_.end(); }
+  [[nodiscard]] ConstIterator begin() const noexcept { return list_.begin(); }
+  [[nodiscard]] ConstIterator end() const noexcept { return list_.end(); }
+  [[nodiscard]] ConstIterator cbegin() const noexcept { return begin(); }
+  [[nodiscard]] ConstIterator cend() const noexcept { return end(); }
+  [[nodiscard]] Iterator before_begin() noexcept {
+    return list_.before_begin();
+  }
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return list_.before_begin();
+  }
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return before_begin();
+  }
+
+  // Возвращает итератор на элемент с номером position
+  [[nodiscard]] Iterator IteratorAt(size_t position) {
+    assert(position < GetSize());
+    const auto first = checkpoints_.begin() + first_checkpoint_;
+    const auto last = checkpoints_.end();
+    const auto next = std::upper_bound(
+        first, last, position, [this](size_t p, const Checkpoint &checkpoint) {
+          return p < GetPosition(checkpoint);
+        });
+
+    size_t current = 0;
+    Iterator it = list_.begin();
+    // Проход продолжает индекс, если начинается не раньше последней опорной
+    // точки. Иначе элементы прохода уже покрыты индексом
+    bool extends_index = next == last;
+    if (next != first) {
+      current = GetPosition(*std::prev(next));
+      it = std::prev(next)->it;
+    } else if (first != last && position >= kStride) {
+      // Перед первой опорной точкой накопились элементы, вставленные в
+      // начало. Индекс строится заново тем же проходом
+      ResetIndex();
+      extends_index = true;
+    }
+    if (cursor_ && GetPosition(*cursor_) <= position &&
+        GetPosition(*cursor_) > current) {
+      current = GetPosition(*cursor_);
+      it = cursor_->it;
+    }
+
+    size_t last_indexed = first_checkpoint_ < checkpoints_.size()
+                              ? GetPosition(checkpoints_.back())
+                              : 0;
+    for (; current < position; ++current) {
+      ++it;
+      if (extends_index && current + 1 >= last_indexed + kStride) {
+        checkpoints_.push_back(MakeCheckpoint(current + 1, it));
+        last_indexed = current + 1;
+      }
+    }
+    cursor_ = MakeCheckpoint(position, it);
+    return it;
+  }
+
+  [[nodiscard]] Type &At(size_t position) { return *IteratorAt(position); }
+
+  /*
+   * Возвращает итератор, отстоящий от it на distance элементов
+   * Если номер it известен — it равен before_begin, begin или итератору,
+   * найденному последним вызовом IteratorAt, — переход выполняется через
+   * индекс. Иначе итератор продвигается за O(distance)
+   */
+  [[nodiscard]] Iterator Advance(Iterator it, size_t distance) {
+    std::optional<size_t> target;
+    if (it == list_.before_begin()) {
+      // Номер before_begin на единицу меньше номера begin
+      if (distance == 0) {
+        return it;
+      }
+      target = distance - 1;
+    } else if (it == list_.begin()) {
+      target = distance;
+    } else if (cursor_ && it == cursor_->it) {
+      target = GetPosition(*cursor_) + distance;
+    }
+    if (!target) {
+      std::advance(it, distance);
+      return it;
+    }
+    assert(*target <= GetSize());
+    return *target == GetSize() ? list_.end() : IteratorAt(*target);
+  }
+
+  void PushFront(const Type &value) { EmplaceFront(value); }
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  // Номера всех опорных точек увеличиваются на единицу за O(1)
+  template <typename... Args>
+  Type &EmplaceFront(Args &&...args) {
+    Type &value = list_.EmplaceFront(std::forward<Args>(args)...);
+    ++shift_;
+    return value;
+  }
+
+  void PushBack(const Type &value) { EmplaceBack(value); }
+  void PushBack(Type &&value) { EmplaceBack(std::move(value)); }
+
+  // Вставка в конец не изменяет номера элементов
+  template <typename... Args>
+  Type &EmplaceBack(Args &&...args) {
+    return list_.EmplaceBack(std::forward<Args>(args)...);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  Iterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    if (pos == list_.cbefore_begin()) {
+      EmplaceFront(std::forward<Args>(args)...);
+      return list_.begin();
+    }
+    const std::optional<size_t> position = FindPosition(pos);
+    Iterator it = list_.EmplaceAfter(pos, std::forward<Args>(args)...);
+    InvalidateFrom(position ? *position + 1 : 0);
+    return it;
+  }
+
+  void PopFront() noexcept {
+    assert(!IsEmpty());
+    if (first_checkpoint_ < checkpoints_.size() &&
+        GetPosition(checkpoints_[first_checkpoint_]) == 0) {
+      ++first_checkpoint_;
+    }
+    if (cursor_ && GetPosition(*cursor_) == 0) {
+      cursor_.reset();
+    }
+    list_.PopFront();
+    --shift_;
+  }
+
+  Iterator EraseAfter(ConstIterator pos) noexcept {
+    if (pos == list_.cbefore_begin()) {
+      PopFront();
+      return list_.begin();
+    }
+    const std::optional<size_t> position = FindPosition(pos);
+    InvalidateFrom(position ? *position + 1 : 0);
+    return list_.EraseAfter(pos);
+  }
+
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred) {
+    ResetIndex();
+    return list_.RemoveIf(pred);
+  }
+
+  size_t Remove(const Type &value) {
+    ResetIndex();
+    return list_.Remove(value);
+  }
+
+  template <typename Compare>
+  void Sort(Compare comp) {
+    ResetIndex();
+    list_.Sort(comp);
+  }
+
+  void Sort() { Sort(std::less<>()); }
+
+  void Clear() noexcept {
+    ResetIndex();
+    list_.Clear();
+  }
+
+  void swap(PositionalSingleLinkedList &other) noexcept {
+    list_.swap(other.list_);
+    checkpoints_.swap(other.checkpoints_);
+    std::swap(first_checkpoint_, other.first_checkpoint_);
+    std::swap(shift_, other.shift_);
+    std::swap(cursor_, other.cursor_);
+  }
+
+ private:
+  // Итератор с известным номером. Номер хранится за вычетом shift_, чтобы
+  // вставка и удаление в начале сдвигали все номера за O(1)
+  struct Checkpoint {
+    size_t position;
+    Iterator it;
+  };
+
+  using CheckpointAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Checkpoint>;
+
+  // Беззнаковое переполнение при вычитании shift_ компенсируется при
+  // обратном сложении
+  [[nodiscard]] size_t GetPosition(
+      const Checkpoint &checkpoint) const noexcept {
+    return checkpoint.position + shift_;
+  }
+
+  [[nodiscard]] Checkpoint MakeCheckpoint(size_t position,
+                                          Iterator it) const noexcept {
+    return Checkpoint{position - shift_, it};
+  }
+
+  // Возвращает номер элемента pos, если его можно определить за O(1)
+  std::optional<size_t> FindPosition(ConstIterator pos) const noexcept {
+    if (pos == list_.begin()) {
+      return 0;
+    }
+    if (cursor_ && pos == cursor_->it) {
+      return GetPosition(*cursor_);
+    }
+    if (std::next(pos) == list_.end()) {
+      return GetSize() - 1;
+    }
+    return std::nullopt;
+  }
+
+  // Отбрасывает опорные точки с номерами не меньше position, номера которых
+  // изменились
+  void InvalidateFrom(size_t position) noexcept {
+    while (checkpoints_.size() > first_checkpoint_ &&
+           GetPosition(checkpoints_.back()) >= position) {
+      checkpoints_.pop_back();
+    }
+    if (checkpoints_.size() == first_checkpoint_) {
+      ResetCheckpoints();
+    }
+    if (cursor_ && GetPosition(*cursor_) >= position) {
+      cursor_.reset();
+    }
+  }
+
+  void ResetCheckpoints() noexcept {
+    checkpoints_.clear();
+    first_checkpoint_ = 0;
+  }
+
+  void ResetIndex() noexcept {
+    ResetCheckpoints();
+    cursor_.reset();
+  }
+
+  List list_;
+  // Опорные точки в порядке возрастания номеров. Точки до first_checkpoint_
+  // удалены PopFront
+  std::vector<Checkpoint, CheckpointAllocator> checkpoints_;
+  size_t first_checkpoint_ = 0;
+  size_t shift_ = 0;
+  // Элемент, найденный последним вызовом IteratorAt
+  std::optional<Checkpoint> cursor_;
+};
+
+template <typename Type, typename Allocator>
+void swap(PositionalSingleLinkedList<Type, Allocator> &lhs,
+          PositionalSingleLinkedList<Type, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator==(const PositionalSingleLinkedList<Type, Allocator> &lhs,
+                const PositionalSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() == rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator!=(const PositionalSingleLinkedList<Type, Allocator> &lhs,
+                const PositionalSingleLinkedList<Type, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator<(const PositionalSingleLinkedList<Type, Allocator> &lhs,
+               const PositionalSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() < rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator<=(const PositionalSingleLinkedList<Type, Allocator> &lhs,
+                const PositionalSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() <= rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator>(const PositionalSingleLinkedList<Type, Allocator> &lhs,
+               const PositionalSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() > rhs.GetList();
+}
+
+template <typename Type, typename Allocator>
+bool operator>=(const PositionalSingleLinkedList<Type, Allocator> &lhs,
+                const PositionalSingleLinkedList<Type, Allocator> &rhs) {
+  return lhs.GetList() >= rhs.GetList();
+}
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "list_compare.h"
+
+/*
+ * Векторные ядра сравнения и поиска для непрерывных фрагментов элементов
+ * арифметических типов
+ * На x86 при поддержке процессором AVX2 фрагмент обрабатывается по 32 байта
+ * за инструкцию (8 элементов int/float или 4 элемента double). Наличие AVX2
+ * проверяется во время выполнения, поэтому программа, собранная без -mavx2,
+ * использует векторные ядра на подходящих процессорах и остаётся переносимой.
+ * На AArch64 используются инструкции NEON, доступные всегда. В остальных
+ * случаях, а также при определённом макросе SLL_DISABLE_SIMD, выполняется
+ * скалярный код
+ * Результаты ядер совпадают с поэлементным применением операторов == и <,
+ * в частности, для чисел с плавающей точкой 0.0 == -0.0, а NaN не равен
+ * ничему
+ */
+
+#if !defined(SLL_DISABLE_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define SLL_SIMD_X86 1
+#include <immintrin.h>
+#define SLL_SIMD_TARGET __attribute__((target("avx2")))
+#elif !defined(SLL_DISABLE_SIMD) && defined(__aarch64__) && \
+    defined(__ARM_NEON)
+#define SLL_SIMD_NEON 1
+#include <arm_neon.h>
+#define SLL_SIMD_TARGET
+#endif
+
+namespace simd {
+
+// Набор инструкций, которым выполняются векторные ядра
+enum class Isa { kScalar, kAvx2, kNeon };
+
+// Истинно для типов, фрагменты которых обрабатываются векторными ядрами
+template <typename Type>
+inline constexpr bool kIsVectorizable =
+    std::is_same_v<Type, float> || std::is_same_v<Type, double> ||
+    (std::is_integral_v<Type> && !std::is_same_v<Type, bool> &&
+     (sizeof(Type) == 4 || sizeof(Type) == 8));
+
+[[nodiscard]] inline Isa GetActiveIsa() noexcept {
+#if defined(SLL_SIMD_X86)
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2 ? Isa::kAvx2 : Isa::kScalar;
+#elif defined(SLL_SIMD_NEON)
+  return Isa::kNeon;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+namespace detail {
+
+// Скалярные версии ядер. Используются для типов без векторной реализации,
+// для хвостов фрагментов и при отсутствии подходящих инструкций
+
+template <typename Type>
+size_t ScalarMismatch(const Type *lhs, const Type *rhs, size_t count) {
+  size_t i = 0;
+  while (i < count && lhs[i] == rhs[i]) {
+    ++i;
+  }
+  return i;
+}
+
+template <typename Type>
+size_t ScalarFind(const Type *data, size_t count, const Type &value) {
+  size_t i = 0;
+  while (i < count && !(data[i] == value)) {
+    ++i;
+  }
+  return i;
+}
+
+template <typename Type>
+size_t ScalarCount(const Type *data, size_t count, const Type &value) {
+  size_t matches = 0;
+  for (size_t i = 0; i < count; ++i) {
+    matches += data[i] == value ? 1 : 0;
+  }
+  return matches;
+}
+
+#if defined(SLL_SIMD_X86) || defined(SLL_SIMD_NEON)
+
+/*
+ * Описание векторного регистра для элементов одного размера: загрузка,
+ * заполнение одним значением и поэлементное сравнение на равенство,
+ * результат которого возвращается битовой маской (бит i — элемент i)
+ * Векторные ядра ниже написаны в терминах этих операций и не зависят от
+ * набора инструкций
+ */
+template <typename Type>
+struct Lanes;
+
+#if defined(SLL_SIMD_X86)
+
+// Целые числа размером 4 байта сравниваются побитово, знак не важен
+struct Int32Lanes {
+  using Vector = __m256i;
+  static constexpr size_t kCount = 8;
+
+  SLL_SIMD_TARGET static Vector Load(const void *data) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i *>(data));
+  }
+  SLL_SIMD_TARGET static Vector Broadcast(const void *value) noexcept {
+    int32_t lane;
+    std::memcpy(&lane, value, sizeof(lane));
+    return _mm256_set1_epi32(lane);
+  }
+  SLL_SIMD_TARGET static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lhs, rhs))));
+  }
+};
+
+struct Int64Lanes {
+  using Vector = __m256i;
+  static constexpr size_t kCount = 4;
+
+  SLL_SIMD_TARGET static Vector Load(const void *data) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i *>(data));
+  }
+  SLL_SIMD_TARGET static Vector Broadcast(const void *value) noexcept {
+    int64_t lane;
+    std::memcpy(&lane, value, sizeof(lane));
+    return _mm256_set1_epi64x(lane);
+  }
+  SLL_SIMD_TARGET static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return static_cast<unsigned>(
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(lhs, rhs))));
+  }
+};
+
+// Числа с плавающей точкой сравниваются как значения: упорядоченное
+// сравнение даёт ложь для NaN и истину для 0.0 и -0.0
+struct FloatLanes {
+  using Vector = __m256;
+  static constexpr size_t kCount = 8;
+
+  SLL_SIMD_TARGET static Vector Load(const void *data) noexcept {
+    return _mm256_loadu_ps(static_cast<const float *>(data));
+  }
+  SLL_SIMD_TARGET static Vector Broadcast(const void *value) noexcept {
+    return _mm256_set1_ps(*static_cast<const float *>(value));
+  }
+  SLL_SIMD_TARGET static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return static_cast<unsigned>(
+        _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ)));
+  }
+};
+
+struct DoubleLanes {
+  using Vector = __m256d;
+  static constexpr size_t kCount = 4;
+
+  SLL_SIMD_TARGET static Vector Load(const void *data) noexcept {
+    return _mm256_loadu_pd(static_cast<const double *>(data));
+  }
+  SLL_SIMD_TARGET static Vector Broadcast(const void *value) noexcept {
+    return _mm256_set1_pd(*static_cast<const double *>(value));
+  }
+  SLL_SIMD_TARGET static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return static_cast<unsigned>(
+        _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ)));
+  }
+};
+
+#else  // SLL_SIMD_NEON
+
+struct Int32Lanes {
+  using Vector = uint32x4_t;
+  static constexpr size_t kCount = 4;
+
+  static Vector Load(const void *data) noexcept {
+    return vld1q_u32(static_cast<const uint32_t *>(data));
+  }
+  static Vector Broadcast(const void *value) noexcept {
+    uint32_t lane;
+    std::memcpy(&lane, value, sizeof(lane));
+    return vdupq_n_u32(lane);
+  }
+  static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return ToMask(vceqq_u32(lhs, rhs));
+  }
+  static unsigned ToMask(uint32x4_t equal) noexcept {
+    const uint32_t bits[] = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(equal, vld1q_u32(bits)));
+  }
+};
+
+struct Int64Lanes {
+  using Vector = uint64x2_t;
+  static constexpr size_t kCount = 2;
+
+  static Vector Load(const void *data) noexcept {
+    return vld1q_u64(static_cast<const uint64_t *>(data));
+  }
+  static Vector Broadcast(const void *value) noexcept {
+    uint64_t lane;
+    std::memcpy(&lane, value, sizeof(lane));
+    return vdupq_n_u64(lane);
+  }
+  static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return ToMask(vceqq_u64(lhs, rhs));
+  }
+  static unsigned ToMask(uint64x2_t equal) noexcept {
+    const uint64_t bits[] = {1, 2};
+    return static_cast<unsigned>(
+        vaddvq_u64(vandq_u64(equal, vld1q_u64(bits))));
+  }
+};
+
+struct FloatLanes {
+  using Vector = float32x4_t;
+  static constexpr size_t kCount = 4;
+
+  static Vector Load(const void *data) noexcept {
+    return vld1q_f32(static_cast<const float *>(data));
+  }
+  static Vector Broadcast(const void *value) noexcept {
+    return vdupq_n_f32(*static_cast<const float *>(value));
+  }
+  static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return Int32Lanes::ToMask(vceqq_f32(lhs, rhs));
+  }
+};
+
+struct DoubleLanes {
+  using Vector = float64x2_t;
+  static constexpr size_t kCount = 2;
+
+  static Vector Load(const void *data) noexcept {
+    return vld1q_f64(static_cast<const double *>(data));
+  }
+  static Vector Broadcast(const void *value) noexcept {
+    return vdupq_n_f64(*static_cast<const double *>(value));
+  }
+  static unsigned EqualMask(Vector lhs, Vector rhs) noexcept {
+    return Int64Lanes::ToMask(vceqq_f64(lhs, rhs));
+  }
+};
+
+#endif
+
+template <>
+struct Lanes<float> : FloatLanes {};
+
+template <>
+struct Lanes<double> : DoubleLanes {};
+
+// Для целых чисел регистр выбирается по размеру типа
+template <typename Type>
+struct Lanes
+    : std::conditional_t<sizeof(Type) == 4, Int32Lanes, Int64Lanes> {};
+
+// Векторные ядра обрабатывают только целые регистры и возвращают позицию,
+// на которой остановились. Хвост фрагмента обрабатывает скалярный код
+
+template <typename L>
+SLL_SIMD_TARGET size_t VectorMismatch(const unsigned char *lhs,
+                                      const unsigned char *rhs, size_t count,
+                                      size_t element_size) noexcept {
+  constexpr unsigned kFull = (1u << L::kCount) - 1;
+  size_t i = 0;
+  for (; i + L::kCount <= count; i += L::kCount) {
+    const unsigned mask = L::EqualMask(L::Load(lhs + i * element_size),
+                                       L::Load(rhs + i * element_size));
+    if (mask != kFull) {
+      return i + static_cast<size_t>(__builtin_ctz(~mask));
+    }
+  }
+  return i;
+}
+
+template <typename L>
+SLL_SIMD_TARGET size_t VectorFind(const unsigned char *data, size_t count,
+                                  const void *value,
+                                  size_t element_size) noexcept {
+  const auto needle = L::Broadcast(value);
+  size_t i = 0;
+  for (; i + L::kCount <= count; i += L::kCount) {
+    const unsigned mask =
+        L::EqualMask(L::Load(data + i * element_size), needle);
+    if (mask != 0) {
+      return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+  }
+  return i;
+}
+
+template <typename L>
+SLL_SIMD_TARGET size_t VectorCount(const unsigned char *data, size_t count,
+                                   const void *value,
+                                   size_t element_size) noexcept {
+  const auto needle = L::Broadcast(value);
+  size_t matches = 0;
+  for (size_t i = 0; i + L::kCount <= count; i += L::kCount) {
+    matches += static_cast<size_t>(__builtin_popcount(
+        L::EqualMask(L::Load(data + i * element_size), needle)));
+  }
+  return matches;
+}
+
+#endif
+
+// Истинно, если векторные ядра применимы к Type на текущем процессоре
+template <typename Type>
+bool UseVectorKernels() noexcept {
+  if constexpr (kIsVectorizable<Type>) {
+    return GetActiveIsa() != Isa::kScalar;
+  } else {
+    return false;
+  }
+}
+
+}  // namespace detail
+
+// Возвращает позицию первой пары неравных элементов фрагментов lhs и rhs
+// длины count или count, если фрагменты равны
+template <typename Type>
+size_t Mismatch(const Type *lhs, const Type *rhs, size_t count) {
+  size_t i = 0;
+#if defined(SLL_SIMD_X86) || defined(SLL_SIMD_NEON)
+  if constexpr (kIsVectorizable<Type>) {
+    if (detail::UseVectorKernels<Type>()) {
+      i = detail::VectorMismatch<detail::Lanes<Type>>(
+          reinterpret_cast<const unsigned char *>(lhs),
+          reinterpret_cast<const unsigned char *>(rhs), count, sizeof(Type));
+    }
+  }
+#endif
+  return i + detail::ScalarMismatch(lhs + i, rhs + i, count - i);
+}
+
+// Возвращает позицию первого элемента фрагмента, равного value, или count
+template <typename Type>
+size_t Find(const Type *data, size_t count, const Type &value) {
+  size_t i = 0;
+#if defined(SLL_SIMD_X86) || defined(SLL_SIMD_NEON)
+  if constexpr (kIsVectorizable<Type>) {
+    if (detail::UseVectorKernels<Type>()) {
+      i = detail::VectorFind<detail::Lanes<Type>>(
+          reinterpret_cast<const unsigned char *>(data), count, &value,
+          sizeof(Type));
+    }
+  }
+#endif
+  return i + detail::ScalarFind(data + i, count - i, value);
+}
+
+// Возвращает количество элементов фрагмента, равных value
+template <typename Type>
+size_t Count(const Type *data, size_t count, const Type &value) {
+  size_t matches = 0;
+  size_t i = 0;
+#if defined(SLL_SIMD_X86) || defined(SLL_SIMD_NEON)
+  if constexpr (kIsVectorizable<Type>) {
+    if (detail::UseVectorKernels<Type>()) {
+      matches = detail::VectorCount<detail::Lanes<Type>>(
+          reinterpret_cast<const unsigned char *>(data), count, &value,
+          sizeof(Type));
+      i = count - count % detail::Lanes<Type>::kCount;
+    }
+  }
+#endif
+  return matches + detail::ScalarCount(data + i, count - i, value);
+}
+
+/*
+ * Лексикографически сравнивает фрагменты lhs и rhs длины count с тем же
+ * результатом, что и ::detail::CompareThreeWay. Равные префиксы
+ * пропускаются векторным Mismatch, а операторы < применяются только к
+ * первой паре различающихся элементов
+ */
+template <typename Type>
+::detail::ThreeWayResult CompareThreeWay(const Type *lhs, const Type *rhs,
+                                         size_t count) {
+  ::detail::ThreeWayResult result;
+  for (size_t i = Mismatch(lhs, rhs, count); i < count;
+       i += 1 + Mismatch(lhs + i + 1, rhs + i + 1, count - i - 1)) {
+    if (lhs[i] < rhs[i]) {
+      return {-1, false};
+    }
+    if (rhs[i] < lhs[i]) {
+      return {1, false};
+    }
+    // Элементы эквивалентны, но не равны
+    result.equal = false;
+  }
+  return result;
+}
+
+}  // namespace simd
@@ -0,0 +1,1520 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "list_compare.h"
+#include "list_hash.h"
+#include "list_prefetch.h"
+#include "list_stats.h"
+
+// Односвязный список. Узлы размещаются при помощи аллокатора Allocator,
+// совместимого с std::allocator_traits (например, std::allocator или
+// std::pmr::polymorphic_allocator). Указатели аллокатора должны быть обычными
+// указателями
+// При сборке с SLL_ENABLE_STATS список ведёт статистику своей работы (см.
+// list_stats.h), доступную через GetStats
+template <typename Type, typename Allocator = std::allocator<Type>>
+class SingleLinkedList : private detail::ListStatsRecorder<> {
+  using StatsRecorder = detail::ListStatsRecorder<>;
+
+  // Сравнения учитываются в статистике обоих списков
+  template <typename T, typename A>
+  friend bool operator==(const SingleLinkedList<T, A> &lhs,
+                         const SingleLinkedList<T, A> &rhs);
+  template <typename T, typename A>
+  friend detail::ThreeWayResult CompareThreeWay(
+      const SingleLinkedList<T, A> &lhs, const SingleLinkedList<T, A> &rhs);
+
+  struct Node;
+
+  // Звено списка без значения. Фиктивный узел перед первым элементом
+  // является только звеном, поэтому пустой список не конструирует Type, а
+  // Type не обязан иметь конструктор по умолчанию
+  struct NodeBase {
+    Node *next_node = nullptr;
+  };
+
+  // Узел списка
+  struct Node : NodeBase {
+    // Конструирует значение узла на месте из переданных аргументов
+    template <typename... Args>
+    explicit Node(Node *next, Args &&...args)
+        : NodeBase{next}, value(std::forward<Args>(args)...) {}
+    Type value;
+  };
+
+  template <typename ValueType>
+  class BasicIterator {
+    friend class SingleLinkedList;
+    // Конвертирующий конструктор итератора из указателя на узел списка
+    explicit BasicIterator(NodeBase *node) : node_(node) {}
+
+   public:
+    // Объявленные ниже типы сообщают стандартной библиотеке о свойствах этого
+    // итератора
+
+    // Категория итератора — forward iterator
+    // (итератор, который поддерживает операции инкремента и многократное
+    // разыменование)
+    using iterator_category = std::forward_iterator_tag;
+    // Тип элементов, по которым перемещается итератор
+    using value_type = Type;
+    // Тип, используемый для хранения смещения между итераторами
+    using difference_type = std::ptrdiff_t;
+    // Тип указателя на итерируемое значение
+    using pointer = ValueType *;
+    // Тип ссылки на итерируемое значение
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    // Конвертирующий конструктор/конструктор копирования
+    // При ValueType, совпадающем с Type, играет роль копирующего конструктора
+    // При ValueType, совпадающем с const Type, играет роль конвертирующего
+    // конструктора
+    BasicIterator(const BasicIterator<Type> &other) noexcept {
+      node_ = other.node_;
+    }
+
+    // Чтобы компилятор не выдавал предупреждение об отсутствии оператора = при
+    // наличии пользовательского конструктора копирования, явно объявим оператор
+    // = и попросим компилятор сгенерировать его за нас
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    // Оператор сравнения итераторов (в роли второго аргумента выступает
+    // константный итератор) Два итератора равны, если они ссылаются на один и
+    // тот же элемент списка либо на end()
+    [[nodiscard]] bool operator==(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return (node_ == rhs.node_);
+    }
+
+    // Оператор проверки итераторов на неравенство
+    // Противоположен !=
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return (node_ != rhs.node_);
+    }
+
+    // Оператор сравнения итераторов (в роли второго аргумента итератор)
+    // Два итератора равны, если они ссылаются на один и тот же элемент списка
+    // либо на end()
+    [[nodiscard]] bool operator==(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return (node_ == rhs.node_);
+    }
+
+    // Оператор проверки итераторов на неравенство
+    // Противоположен !=
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return node_ != rhs.node_;
+    }
+
+    // Оператор прединкремента. После его вызова итератор указывает на следующий
+    // элемент списка Возвращает ссылку на самого себя Инкремент итератора, не
+    // указывающего на существующий элемент списка, приводит к неопределённому
+    // поведению
+    BasicIterator &operator++() noexcept {
+      Advance();
+      return *this;
+    }
+
+    // Оператор постинкремента. После его вызова итератор указывает на следующий
+    // элемент списка Возвращает прежнее значение итератора Инкремент итератора,
+    // не указывающего на существующий элемент списка, приводит к
+    // неопределённому поведению
+    BasicIterator operator++(int) noexcept {
+      BasicIterator this_prev(node_);
+      Advance();
+      return this_prev;
+    }
+
+    // Операция разыменования. Возвращает ссылку на текущий элемент
+    // Вызов этого оператора у итератора, не указывающего на существующий
+    // элемент списка, приводит к неопределённому поведению
+    [[nodiscard]] reference operator*() const noexcept {
+      return static_cast<Node *>(node_)->value;
+    }
+
+    // Операция доступа к члену класса. Возвращает указатель на текущий элемент
+    // списка Вызов этого оператора у итератора, не указывающего на существующий
+    // элемент списка, приводит к неопределённому поведению
+    [[nodiscard]] pointer operator->() const noexcept {
+      return &static_cast<Node *>(node_)->value;
+    }
+
+   private:
+    // С SLL_ENABLE_PREFETCH запрашивает узел, следующий за новым текущим,
+    // чтобы его загрузка шла, пока вызывающий код обрабатывает текущий
+    // элемент. Этим пользуются все обходы через итераторы: сравнения,
+    // копирование, ForEach
+    void Advance() noexcept {
+      node_ = node_->next_node;
+      if constexpr (kListPrefetchEnabled) {
+        if (node_ != nullptr) {
+          detail::PrefetchForRead(node_->next_node);
+        }
+      }
+    }
+
+    // Звено, на которое указывает итератор. before_begin() указывает на
+    // фиктивный узел, остальные итераторы — на узлы со значениями
+    NodeBase *node_ = nullptr;
+  };
+
+  // Свободный узел из запаса, созданного Reserve. Размещается в памяти узла
+  // вместо него самого
+  struct SpareNode {
+    SpareNode *next = nullptr;
+  };
+
+  // Цепочка узлов, ещё не присоединённая к списку
+  struct Chain {
+    Node *first = nullptr;
+    Node *last = nullptr;
+    size_t size = 0;
+  };
+
+  // Разрешает перегрузку только для типов итераторов
+  template <typename InputIt>
+  using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<InputIt>::iterator_category,
+      std::input_iterator_tag>>;
+
+  // Разрешает перегрузку только для генераторов: вызываемых объектов без
+  // аргументов, возвращающих std::optional<Type>. Перегрузки для генераторов
+  // и диапазонов различаются лишь условием, поэтому условие задаёт тип
+  // параметра шаблона, а не его значение по умолчанию
+  template <typename Generator>
+  using RequireGenerator =
+      std::enable_if_t<std::is_same_v<
+                           std::remove_cv_t<std::invoke_result_t<Generator &>>,
+                           std::optional<Type>>,
+                       int>;
+
+  // Разрешает перегрузку только для диапазонов с итераторами ввода
+  template <typename Range>
+  using RequireRange = std::enable_if_t<
+      std::is_void_v<RequireInputIterator<decltype(std::begin(
+          std::declval<Range &>()))>>,
+      int>;
+
+  template <typename It>
+  static constexpr bool kIsForwardIterator = std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::forward_iterator_tag>;
+
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  static_assert(std::is_same_v<typename NodeTraits::pointer, Node *>,
+                "Allocator must use raw pointers");
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  // Итератор, допускающий изменение элементов списка
+  using Iterator = BasicIterator<Type>;
+  // Константный итератор, предоставляющий доступ для чтения к элементам списка
+  using ConstIterator = BasicIterator<const Type>;
+
+  // Размер и выравнивание узла — блока памяти, запрашиваемого у аллокатора
+  // для каждого элемента
+  static constexpr size_t kNodeSize = sizeof(Node);
+  static constexpr size_t kNodeAlignment = alignof(Node);
+
+  // Возвращает итератор, ссылающийся на первый элемент
+  // Если список пустой, возвращённый итератор будет равен end()
+  [[nodiscard]] Iterator begin() noexcept { return Iterator(head_.next_node); }
+  // Возвращает итератор, указывающий на позицию, следующую за последним
+  // элементом односвязного списка Разыменовывать этот итератор нельзя — попытка
+  // разыменования приведёт к неопределённому поведению
+  // Последний узел всегда ссылается на nullptr, поэтому end() вычисляется за
+  // время O(1)
+  [[nodiscard]] Iterator end() noexcept { return Iterator(nullptr); }
+
+  // Возвращает константный итератор, ссылающийся на первый элемент
+  // Если список пустой, возвращённый итератор будет равен end()
+  // Результат вызова эквивалентен вызову метода cbegin()
+  [[nodiscard]] ConstIterator begin() const noexcept {
+    return ConstIterator(head_.next_node);
+  }
+
+  // Возвращает константный итератор, указывающий на позицию, следующую за
+  // последним элементом односвязного списка Разыменовывать этот итератор нельзя
+  // — попытка разыменования приведёт к неопределённому поведению Результат
+  // вызова эквивалентен вызову метода cend()
+  [[nodiscard]] ConstIterator end() const noexcept {
+    return ConstIterator(nullptr);
+  }
+
+  // Возвращает константный итератор, ссылающийся на первый элемент
+  // Если список пустой, возвращённый итератор будет равен cend()
+  [[nodiscard]] ConstIterator cbegin() const noexcept {
+    return ConstIterator(head_.next_node);
+  }
+
+  // Возвращает константный итератор, указывающий на позицию, следующую за
+  // последним элементом односвязного списка Разыменовывать этот итератор нельзя
+  // — попытка разыменования приведёт к неопределённому поведению
+  [[nodiscard]] ConstIterator cend() const noexcept { return this->end(); }
+
+  SingleLinkedList() {
+    head_.next_node = nullptr;
+    size_ = 0;
+  }
+
+  // Создаёт пустой список, узлы которого будут размещаться аллокатором alloc
+  explicit SingleLinkedList(const Allocator &alloc) : alloc_(alloc) {
+    head_.next_node = nullptr;
+    size_ = 0;
+  }
+
+  // Возвращает копию аллокатора, используемого списком
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  // Статистика списка. Без SLL_ENABLE_STATS содержит нули
+  using StatsRecorder::GetStats;
+  using StatsRecorder::ResetStats;
+
+  // Возвращает количество элементов в списке
+  [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+  // Сообщает, пустой ли список
+  [[nodiscard]] bool IsEmpty() const noexcept {
+    return head_.next_node == nullptr;
+  }
+
+  // Вызывает func для каждого элемента списка по порядку. С
+  // SLL_ENABLE_PREFETCH следующий узел запрашивается до вызова func для
+  // текущего элемента
+  template <typename Function>
+  void ForEach(Function func) {
+    for (Iterator it = begin(); it != end(); ++it) {
+      func(*it);
+    }
+  }
+
+  template <typename Function>
+  void ForEach(Function func) const {
+    for (ConstIterator it = begin(); it != end(); ++it) {
+      func(*it);
+    }
+  }
+
+  // Вставляет элемент value в начало списка за время O(1)
+  void PushFront(const Type &value) { EmplaceFront(value); }
+
+  // Перемещает элемент value в начало списка за время O(1)
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  // Конструирует элемент в начале списка из аргументов args за время O(1)
+  // Возвращает ссылку на созданный элемент
+  // Если при создании элемента будет выброшено исключение, список останется в
+  // прежнем состоянии
+  template <typename... Args>
+  Type &EmplaceFront(Args &&...args) {
+    head_.next_node = CreateNode(head_.next_node, std::forward<Args>(args)...);
+    if (tail_ == &head_) {
+      tail_ = head_.next_node;
+    }
+    size_++;
+    RecordSize(size_);
+    return head_.next_node->value;
+  }
+
+  // Вставляет элемент value в конец списка за время O(1)
+  // Если при создании элемента будет выброшено исключение, список останется в
+  // прежнем состоянии
+  void PushBack(const Type &value) { EmplaceBack(value); }
+
+  // Перемещает элемент value в конец списка за время O(1)
+  void PushBack(Type &&value) { EmplaceBack(std::move(value)); }
+
+  // Конструирует элемент в конце списка из аргументов args за время O(1)
+  // Возвращает ссылку на созданный элемент
+  template <typename... Args>
+  Type &EmplaceBack(Args &&...args) {
+    Node *node = CreateNode(nullptr, std::forward<Args>(args)...);
+    tail_->next_node = node;
+    tail_ = node;
+    size_++;
+    RecordSize(size_);
+    return node->value;
+  }
+
+  // Очищает список за время O(N)
+  void Clear() noexcept {
+    const auto timer = TimeClear();
+    RecordClear();
+    EraseTail(&head_);
+  }
+
+  ~SingleLinkedList() {
+    EraseTail(&head_);
+    ShrinkToFit();
+  }
+
+  SingleLinkedList(std::initializer_list<Type> values,
+                   const Allocator &alloc = Allocator())
+      : SingleLinkedList(values.begin(), values.end(), alloc) {}
+
+  // Создаёт список из элементов диапазона [first, last) в том же порядке
+  // Для однонаправленных итераторов узлы всего диапазона выделяются заранее
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  SingleLinkedList(InputIt first, InputIt last,
+                   const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    size_ = 0;
+    try {
+      AppendRange(first, last);
+    } catch (...) {
+      ShrinkToFit();
+      throw;
+    }
+  }
+
+  // Создаёт список из элементов, которые возвращает generator, пока тот не
+  // вернёт std::nullopt
+  template <typename Generator, RequireGenerator<Generator> = 0>
+  explicit SingleLinkedList(Generator &&generator,
+                            const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    size_ = 0;
+    try {
+      AppendFrom(std::forward<Generator>(generator));
+    } catch (...) {
+      ShrinkToFit();
+      throw;
+    }
+  }
+
+  // Создаёт список из значений, читаемых из input до конца потока или первой
+  // ошибки чтения
+  explicit SingleLinkedList(std::istream &input,
+                            const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    size_ = 0;
+    try {
+      AppendFrom(input);
+    } catch (...) {
+      ShrinkToFit();
+      throw;
+    }
+  }
+
+  /*
+   * Добавляет элементы диапазона [first, last) в конец списка
+   * Для однонаправленных итераторов узлы резервируются до начала копирования
+   * Если при создании элемента будет выброшено исключение, список останется в
+   * прежнем состоянии
+   */
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void AppendRange(InputIt first, InputIt last) {
+    if constexpr (kIsForwardIterator<InputIt>) {
+      Reserve(size_ + static_cast<size_t>(std::distance(first, last)));
+    }
+    LinkChainAfter(tail_, BuildChain(first, last));
+  }
+
+  // Количество узлов, которое AppendFrom по умолчанию резервирует за раз
+  static constexpr size_t kDefaultAppendBatch = 256;
+
+  /*
+   * Добавляет в конец списка элементы, которые возвращает generator, пока
+   * тот не вернёт std::nullopt. Элементы перемещаются в узлы по одному, без
+   * промежуточного контейнера, а узлы резервируются блоками по batch_size,
+   * поэтому аллокатор, выделяющий память пулами, вызывается batch_size раз
+   * подряд. Неиспользованную часть последнего блока список сохраняет в
+   * запасе, её освобождает ShrinkToFit. При batch_size == 0 каждый узел
+   * выделяется отдельно
+   * Если generator или конструктор элемента выбросит исключение, список
+   * останется в прежнем состоянии
+   */
+  template <typename Generator, RequireGenerator<Generator> = 0>
+  void AppendFrom(Generator &&generator,
+                  size_t batch_size = kDefaultAppendBatch) {
+    Chain chain;
+    try {
+      for (std::optional<Type> value = generator(); value.has_value();
+           value = generator()) {
+        if (spare_count_ == 0) {
+          Reserve(size_ + batch_size);
+        }
+        AppendToChain(chain, CreateNode(nullptr, std::move(*value)));
+      }
+    } catch (...) {
+      DestroyChain(chain.first);
+      throw;
+    }
+    LinkChainAfter(tail_, chain);
+  }
+
+  /*
+   * Добавляет в конец списка значения, читаемые из input оператором >>, до
+   * конца потока или первой ошибки чтения, как std::istream_iterator.
+   * Причину остановки сообщает состояние потока. Узлы резервируются блоками
+   * по batch_size, как в AppendFrom для генератора
+   */
+  void AppendFrom(std::istream &input,
+                  size_t batch_size = kDefaultAppendBatch) {
+    AppendFrom(
+        [&input]() -> std::optional<Type> {
+          Type value;
+          if (input >> value) {
+            return value;
+          }
+          return std::nullopt;
+        },
+        batch_size);
+  }
+
+  /*
+   * Добавляет в конец списка элементы диапазона range. Для диапазонов с
+   * однонаправленными итераторами узлы резервируются сразу для всех
+   * элементов, как в AppendRange, а для диапазонов с итераторами ввода —
+   * блоками по batch_size
+   */
+  template <typename Range, RequireRange<Range> = 0>
+  void AppendFrom(Range &&range, size_t batch_size = kDefaultAppendBatch) {
+    auto first = std::begin(range);
+    auto last = std::end(range);
+    if constexpr (kIsForwardIterator<decltype(first)>) {
+      AppendRange(first, last);
+    } else {
+      AppendFrom(
+          [&first, &last]() -> std::optional<Type> {
+            if (first == last) {
+              return std::nullopt;
+            }
+            std::optional<Type> value(*first);
+            ++first;
+            return value;
+          },
+          batch_size);
+    }
+  }
+
+  /*
+   * Заменяет содержимое списка элементами диапазона [first, last),
+   * перезаписывая значения в уже имеющихся узлах. Недостающие узлы создаются,
+   * лишние — удаляются
+   * Если будет выброшено исключение, список останется корректным, но часть
+   * его значений может быть уже перезаписана
+   */
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void Assign(InputIt first, InputIt last) {
+    NodeBase *prev = &head_;
+    for (; first != last && prev->next_node != nullptr; ++first) {
+      prev->next_node->value = *first;
+      prev = prev->next_node;
+    }
+    EraseTail(prev);
+    AppendRange(first, last);
+  }
+
+  void Assign(std::initializer_list<Type> values) {
+    Assign(values.begin(), values.end());
+  }
+
+  /*
+   * Заранее выделяет узлы так, чтобы список мог содержать capacity элементов
+   * без обращений к аллокатору. Запас используется при любой вставке
+   * элементов и освобождается методом ShrinkToFit или при разрушении списка
+   */
+  void Reserve(size_t capacity) {
+    while (size_ + spare_count_ < capacity) {
+      PushSpare(AllocateNode());
+    }
+  }
+
+  // Возвращает количество элементов, которое список может содержать без
+  // выделения новых узлов
+  [[nodiscard]] size_t GetCapacity() const noexcept {
+    return size_ + spare_count_;
+  }
+
+  // Возвращает аллокатору зарезервированные, но не используемые узлы
+  void ShrinkToFit() noexcept { ReleaseSpares(spare_count_); }
+
+  // Измеряет расположение узлов списка в памяти за время O(N)
+  [[nodiscard]] ListLocality MeasureLocality() const noexcept {
+    return MeasureLinks(&head_, size_);
+  }
+
+  /*
+   * Переносит узлы в новую память в порядке следования элементов, чтобы
+   * соседние элементы оказались рядом и обход не ждал загрузки каждого
+   * узла. Новые узлы запрашиваются у аллокатора подряд, пока прежние ещё
+   * заняты, поэтому аллокатор выдаёт их из непрерывной свободной памяти, а
+   * не из освобождённых вразброс узлов. Прежние узлы освобождаются в конце
+   * Значения перемещаются, если их конструктор перемещения не выбрасывает
+   * исключений, иначе копируются. Если перенос выбросит исключение, список
+   * сохранит все элементы в прежнем порядке
+   * Список остаётся тем же объектом со всеми элементами, но итераторы и
+   * ссылки на элементы становятся недействительными. Запас узлов, созданный
+   * Reserve, сохраняется
+   * С SLL_ENABLE_STATS расположение перенесённых узлов до и после переноса
+   * учитывается в статистике (см. ListStats::relayout_before)
+   */
+  void Compact() {
+    const size_t spare_count = spare_count_;
+    try {
+      CompactAfter(cbefore_begin(), size_);
+    } catch (...) {
+      ReleaseSpares(spare_count_ - spare_count);
+      throw;
+    }
+    ReleaseSpares(spare_count_ - spare_count);
+  }
+
+  /*
+   * Шаг постепенного Compact: переносит не более max_nodes узлов, следующих
+   * за pos, и возвращает итератор на последний перенесённый элемент — pos
+   * следующего шага, либо end(), если шаг дошёл до конца списка. Проход по
+   * всему списку начинается с before_begin() и продолжается, пока шаг не
+   * вернёт end(). Между шагами список можно изменять, если элемент pos
+   * следующего шага не удаляется
+   * Память перенесённых узлов остаётся в запасе списка, чтобы следующие шаги
+   * не получили её обратно от аллокатора, и занимается новыми элементами
+   * После прохода остаток запаса возвращает аллокатору ShrinkToFit
+   * Итераторы на перенесённые элементы становятся недействительными, pos
+   * остаётся действительным. Исключения — как в Compact: уже перенесённые
+   * узлы остаются на новом месте
+   */
+  Iterator CompactAfter(ConstIterator pos, size_t max_nodes) {
+    NodeBase *prev = pos.node_;
+    // Адрес узла prev до переноса: переходы до и после переноса считаются
+    // между одними и теми же элементами
+    const void *prev_before = prev;
+    ListLocality before;
+    ListLocality after;
+    size_t relocated = 0;
+    try {
+      while (relocated < max_nodes && prev->next_node != nullptr) {
+        Node *old = prev->next_node;
+        if constexpr (kListPrefetchEnabled) {
+          detail::PrefetchForRead(old->next_node);
+        }
+        Node *node = AllocateNode();
+        try {
+          NodeTraits::construct(alloc_, node, old->next_node,
+                                std::move_if_noexcept(old->value));
+        } catch (...) {
+          NodeTraits::deallocate(alloc_, node, 1);
+          RecordNodeDeallocation();
+          throw;
+        }
+        // Переход от фиктивного узла не ведёт из одного узла в другой
+        if (prev != &head_) {
+          before.RecordLink(prev_before, old);
+          after.RecordLink(prev, node);
+        }
+        prev->next_node = node;
+        if (tail_ == old) {
+          tail_ = node;
+        }
+        NodeTraits::destroy(alloc_, old);
+        PushSpare(old);
+        prev_before = old;
+        prev = node;
+        ++relocated;
+      }
+    } catch (...) {
+      RecordRelayout(relocated, before, after);
+      throw;
+    }
+    if (relocated != 0 && prev->next_node != nullptr) {
+      before.RecordLink(prev_before, prev->next_node);
+      after.RecordLink(prev, prev->next_node);
+    }
+    RecordRelayout(relocated, before, after);
+    return prev->next_node == nullptr ? end() : Iterator(prev);
+  }
+
+  // Копирует элементы other за один проход, добавляя их в конец списка
+  // Если при копировании будет выброшено исключение, созданные узлы будут
+  // удалены
+  SingleLinkedList(const SingleLinkedList &other)
+      : SingleLinkedList(
+            other, Allocator(NodeTraits::select_on_container_copy_construction(
+                       other.alloc_))) {}
+
+  // Копирует элементы other, размещая узлы копии аллокатором alloc
+  SingleLinkedList(const SingleLinkedList &other, const Allocator &alloc)
+      : alloc_(alloc) {
+    size_ = 0;
+    RecordCopyConstruction();
+    try {
+      LinkChainAfter(tail_, BuildChain(other.begin(), other.end()));
+    } catch (...) {
+      ShrinkToFit();
+      throw;
+    }
+  }
+
+  // Забирает узлы списка other за время O(1), оставляя other пустым
+  SingleLinkedList(SingleLinkedList &&other) noexcept : alloc_(other.alloc_) {
+    head_.next_node = nullptr;
+    size_ = 0;
+    RecordMoveConstruction();
+    SwapNodes(other);
+  }
+
+  // Обменивает содержимое списков за время O(1)
+  // Если аллокатор не распространяется при обмене, аллокаторы списков должны
+  // быть равны
+  void swap(SingleLinkedList &other) noexcept {
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc_, other.alloc_);
+    } else {
+      assert(alloc_ == other.alloc_);
+    }
+    SwapNodes(other);
+  }
+
+  // Если присваивание элементов не выбрасывает исключений, значения rhs
+  // записываются в уже существующие узлы списка. Иначе используется идиома
+  // copy-and-swap. В обоих случаях обеспечивается строгая гарантия
+  // безопасности исключений
+  SingleLinkedList &operator=(const SingleLinkedList &rhs) {
+    if (this == &rhs) {
+      return *this;
+    }
+    const auto timer = TimeAssignment();
+    RecordCopyAssignment();
+    if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+      if (alloc_ != rhs.alloc_) {
+        // Узлы копии размещаются аллокатором rhs, а прежние узлы списка
+        // удаляются вместе с tmp прежним аллокатором
+        SingleLinkedList tmp(rhs, Allocator(rhs.alloc_));
+        SwapNodes(tmp);
+        std::swap(alloc_, tmp.alloc_);
+        return *this;
+      }
+    }
+    if constexpr (std::is_nothrow_copy_assignable_v<Type>) {
+      AssignReusingNodes(rhs);
+    } else {
+      SingleLinkedList tmp(rhs, get_allocator());
+      SwapNodes(tmp);
+    }
+    return *this;
+  }
+
+  /*
+   * Присваивает списку элементы rhs, перезаписывая значения в уже имеющихся
+   * узлах. Недостающие узлы создаются, лишние — удаляются
+   * Недостающие узлы создаются до изменения списка, поэтому исключение при их
+   * создании оставляет список в прежнем состоянии. Если исключение выбросит
+   * присваивание элемента, список останется корректным, но часть его значений
+   * может быть уже перезаписана
+   */
+  void AssignReusingNodes(const SingleLinkedList &rhs) {
+    if (this == &rhs) {
+      return;
+    }
+    const size_t common_size = std::min(size_, rhs.size_);
+    auto rhs_rest = rhs.begin();
+    SingleLinkedList extra(get_allocator());
+    if (rhs.size_ > size_) {
+      for (size_t i = 0; i < common_size; ++i) {
+        ++rhs_rest;
+      }
+      for (auto it = rhs_rest; it != rhs.end(); ++it) {
+        extra.PushBack(*it);
+      }
+    }
+
+    NodeBase *prev = &head_;
+    auto rhs_it = rhs.begin();
+    for (size_t i = 0; i < common_size; ++i, ++rhs_it) {
+      prev->next_node->value = *rhs_it;
+      prev = prev->next_node;
+    }
+
+    // Удаляем узлы, для которых в rhs не нашлось значений
+    EraseTail(prev);
+
+    // Присоединяем заранее созданные недостающие узлы
+    AppendNodesOf(extra);
+  }
+
+  // Освобождает собственные узлы и забирает узлы списка rhs за время O(N),
+  // где N — размер текущего списка. rhs остаётся пустым
+  // Если аллокатор не распространяется при перемещении и аллокаторы списков
+  // не равны, элементы rhs перемещаются в новые узлы по одному
+  SingleLinkedList &operator=(SingleLinkedList &&rhs) noexcept(
+      NodeTraits::propagate_on_container_move_assignment::value ||
+      NodeTraits::is_always_equal::value) {
+    if (this == &rhs) {
+      return *this;
+    }
+    const auto timer = TimeAssignment();
+    RecordMoveAssignment();
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+      EraseTail(&head_);
+      ShrinkToFit();
+      alloc_ = rhs.alloc_;
+      SwapNodes(rhs);
+    } else {
+      if (alloc_ == rhs.alloc_) {
+        EraseTail(&head_);
+        SwapNodes(rhs);
+      } else {
+        SingleLinkedList tmp(get_allocator());
+        for (Type &value : rhs) {
+          tmp.PushBack(std::move(value));
+        }
+        SwapNodes(tmp);
+        rhs.EraseTail(&rhs.head_);
+      }
+    }
+    return *this;
+  }
+
+  // Возвращает итератор, указывающий на позицию перед первым элементом
+  // односвязного списка.
+  // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к
+  // неопределённому поведению
+  [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_); }
+
+  // Возвращает константный итератор, указывающий на позицию перед первым
+  // элементом односвязного списка. Разыменовывать этот итератор нельзя -
+  // попытка разыменования приведёт к неопределённому поведению
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return ConstIterator(const_cast<NodeBase *>(&head_));
+  }
+
+  // Возвращает константный итератор, указывающий на позицию перед первым
+  // элементом односвязного списка. Разыменовывать этот итератор нельзя -
+  // попытка разыменования приведёт к неопределённому поведению
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return ConstIterator(cbefore_begin());
+  }
+
+  /*
+   * Вставляет элемент value после элемента, на который указывает pos.
+   * Возвращает итератор на вставленный элемент
+   * Если при создании элемента будет выброшено исключение, список останется в
+   * прежнем состоянии
+   */
+  Iterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  // Перемещает элемент value в позицию после pos
+  // Возвращает итератор на вставленный элемент
+  Iterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  /*
+   * Конструирует элемент из аргументов args после элемента, на который
+   * указывает pos. Возвращает итератор на вставленный элемент
+   * Если при создании элемента будет выброшено исключение, список останется в
+   * прежнем состоянии
+   */
+  template <typename... Args>
+  Iterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    Node *new_node =
+        CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
+    pos.node_->next_node = new_node;
+    if (pos.node_ == tail_) {
+      tail_ = new_node;
+    }
+    size_++;
+    RecordSize(size_);
+    return Iterator(new_node);
+  }
+
+  void PopFront() noexcept {
+    Node *target = head_.next_node;
+    head_.next_node = target->next_node;
+    if (target == tail_) {
+      tail_ = &head_;
+    }
+    DestroyNode(target);
+    size_--;
+  }
+
+  /*
+   * Удаляет элемент, следующий за pos.
+   * Возвращает итератор на элемент, следующий за удалённым
+   */
+  Iterator EraseAfter(ConstIterator pos) noexcept {
+    Node *target = pos.node_->next_node;
+    pos.node_->next_node = target->next_node;
+    if (target == tail_) {
+      tail_ = pos.node_;
+    }
+    DestroyNode(target);
+    size_--;
+    return Iterator(pos.node_->next_node);
+  }
+
+  /*
+   * Переносит все элементы списка other в позицию после pos за время O(1)
+   * Узлы не копируются и не перевыделяются, итераторы на перенесённые элементы
+   * остаются действительными. Аллокаторы списков должны быть равны
+   */
+  void SpliceAfter(ConstIterator pos, SingleLinkedList &other) noexcept {
+    assert(alloc_ == other.alloc_);
+    if (&other == this || other.IsEmpty()) {
+      return;
+    }
+    LinkChainAfter(pos.node_, other.DetachAll());
+  }
+
+  void SpliceAfter(ConstIterator pos, SingleLinkedList &&other) noexcept {
+    SpliceAfter(pos, other);
+  }
+
+  // Переносит все элементы списка other в конец списка за время O(1)
+  // Аллокаторы списков должны быть равны
+  void SpliceBack(SingleLinkedList &other) noexcept {
+    assert(alloc_ == other.alloc_);
+    if (&other == this || other.IsEmpty()) {
+      return;
+    }
+    LinkChainAfter(tail_, other.DetachAll());
+  }
+
+  void SpliceBack(SingleLinkedList &&other) noexcept { SpliceBack(other); }
+
+  // Переносит элемент списка other, следующий за it, в позицию после pos
+  // Если other совпадает с текущим списком и элемент уже стоит после pos
+  // или сам является pos, список не изменяется
+  void SpliceAfter(ConstIterator pos, SingleLinkedList &other,
+                   ConstIterator it) noexcept {
+    if (pos.node_ == it.node_ || pos.node_ == it.node_->next_node) {
+      return;
+    }
+    ConstIterator last = it;
+    ++last;
+    ++last;
+    SpliceAfter(pos, other, it, last);
+  }
+
+  /*
+   * Переносит элементы списка other из интервала (first, last) в позицию
+   * после pos. Узлы перецепляются без выделения памяти, время работы
+   * пропорционально количеству переносимых элементов, так как их нужно
+   * подсчитать. other может совпадать с текущим списком, если pos не лежит
+   * внутри (first, last)
+   */
+  void SpliceAfter(ConstIterator pos, SingleLinkedList &other,
+                   ConstIterator first, ConstIterator last) noexcept {
+    assert(alloc_ == other.alloc_);
+    if (pos.node_ == first.node_) {
+      return;
+    }
+    LinkChainAfter(pos.node_, other.UnlinkAfter(first.node_, last.node_));
+  }
+
+  void SpliceAfter(ConstIterator pos, SingleLinkedList &&other,
+                   ConstIterator first, ConstIterator last) noexcept {
+    SpliceAfter(pos, other, first, last);
+  }
+
+  /*
+   * Удаляет элементы из интервала (first, last) и возвращает их количество
+   * Узлы сначала отсоединяются от списка целиком, а разрушаются после этого
+   */
+  size_t EraseAfter(ConstIterator first, ConstIterator last) noexcept {
+    const Chain chain = UnlinkAfter(first.node_, last.node_);
+    DestroyChain(chain.first);
+    return chain.size;
+  }
+
+  // Переносит элементы из интервала (first, last) в конец списка removed, не
+  // разрушая их. Возвращает количество перенесённых элементов
+  size_t EraseAfter(ConstIterator first, ConstIterator last,
+                    SingleLinkedList &removed) noexcept {
+    assert(alloc_ == removed.alloc_);
+    const Chain chain = UnlinkAfter(first.node_, last.node_);
+    removed.LinkChainAfter(removed.tail_, chain);
+    return chain.size;
+  }
+
+  /*
+   * Удаляет за один проход все элементы, для которых pred возвращает true, и
+   * возвращает их количество
+   * Отсоединённые узлы разрушаются после завершения прохода, поэтому pred
+   * может ссылаться на элементы самого списка
+   */
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred) {
+    Chain removed;
+    try {
+      UnlinkIf(pred, removed);
+    } catch (...) {
+      DestroyChain(removed.first);
+      throw;
+    }
+    DestroyChain(removed.first);
+    return removed.size;
+  }
+
+  /*
+   * Переносит за один проход все элементы, для которых pred возвращает true,
+   * в конец списка removed и возвращает их количество
+   * Элементы не разрушаются и память не освобождается, поэтому удаление можно
+   * выполнить под блокировкой, а разрушить removed — уже после её снятия
+   * Аллокаторы списков должны быть равны
+   */
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred, SingleLinkedList &removed) {
+    assert(alloc_ == removed.alloc_);
+    Chain chain;
+    try {
+      UnlinkIf(pred, chain);
+    } catch (...) {
+      removed.LinkChainAfter(removed.tail_, chain);
+      throw;
+    }
+    removed.LinkChainAfter(removed.tail_, chain);
+    return chain.size;
+  }
+
+  // Удаляет все элементы, равные value, и возвращает их количество
+  // value может ссылаться на элемент самого списка
+  size_t Remove(const Type &value) {
+    return RemoveIf([&value](const Type &item) { return item == value; });
+  }
+
+  size_t Remove(const Type &value, SingleLinkedList &removed) {
+    return RemoveIf([&value](const Type &item) { return item == value; },
+                    removed);
+  }
+
+  /*
+   * Удаляет из каждой группы подряд идущих равных элементов все, кроме
+   * первого, и возвращает количество удалённых элементов. Элементы
+   * сравниваются предикатом pred, по умолчанию — оператором ==
+   */
+  template <typename BinaryPredicate>
+  size_t Unique(BinaryPredicate pred) {
+    Chain removed;
+    try {
+      UnlinkDuplicates(pred, removed);
+    } catch (...) {
+      DestroyChain(removed.first);
+      throw;
+    }
+    DestroyChain(removed.first);
+    return removed.size;
+  }
+
+  size_t Unique() { return Unique(std::equal_to<>()); }
+
+  // Переносит повторяющиеся подряд элементы в конец списка removed, не
+  // разрушая их, и возвращает их количество
+  template <typename BinaryPredicate>
+  size_t Unique(BinaryPredicate pred, SingleLinkedList &removed) {
+    assert(alloc_ == removed.alloc_);
+    Chain chain;
+    try {
+      UnlinkDuplicates(pred, chain);
+    } catch (...) {
+      removed.LinkChainAfter(removed.tail_, chain);
+      throw;
+    }
+    removed.LinkChainAfter(removed.tail_, chain);
+    return chain.size;
+  }
+
+  size_t Unique(SingleLinkedList &removed) {
+    return Unique(std::equal_to<>(), removed);
+  }
+
+  /*
+   * Сливает отсортированный список other с текущим отсортированным списком
+   * за время O(N + M), перецепляя узлы. other становится пустым
+   * Слияние устойчиво: из равных элементов первыми идут элементы текущего
+   * списка. Аллокаторы списков должны быть равны
+   * Если comp выбросит исключение, все элементы обоих списков остаются в
+   * текущем списке в неопределённом порядке, а other становится пустым
+   */
+  template <typename Compare>
+  void Merge(SingleLinkedList &other, Compare comp) {
+    assert(alloc_ == other.alloc_);
+    if (&other == this || other.IsEmpty()) {
+      return;
+    }
+    const Chain lhs = DetachAll();
+    const Chain rhs = other.DetachAll();
+    Chain merged;
+    try {
+      MergeChains(lhs, rhs, comp, merged);
+    } catch (...) {
+      LinkChainAfter(&head_, merged);
+      throw;
+    }
+    LinkChainAfter(&head_, merged);
+  }
+
+  void Merge(SingleLinkedList &other) { Merge(other, std::less<>()); }
+
+  void Merge(SingleLinkedList &&other) { Merge(other); }
+
+  template <typename Compare>
+  void Merge(SingleLinkedList &&other, Compare comp) {
+    Merge(other, comp);
+  }
+
+  /*
+   * Устойчиво сортирует список восходящей сортировкой слиянием за время
+   * O(N log N), перецепляя узлы без выделения памяти. Итераторы на элементы
+   * остаются действительными
+   * Если comp выбросит исключение, список сохраняет все элементы в
+   * неопределённом порядке
+   */
+  template <typename Compare>
+  void Sort(Compare comp) {
+    if (size_ < 2) {
+      return;
+    }
+    for (size_t width = 1; width < size_; width *= 2) {
+      NodeBase *prev = &head_;
+      Node *rest = head_.next_node;
+      while (rest != nullptr) {
+        const Chain left = TakeRun(rest, width);
+        const Chain right = TakeRun(rest, width);
+        Chain merged;
+        try {
+          MergeChains(left, right, comp, merged);
+        } catch (...) {
+          // Необработанные узлы прохода идут после слитых и заканчиваются
+          // прежним последним узлом списка
+          prev->next_node = merged.first;
+          merged.last->next_node = rest;
+          if (rest == nullptr) {
+            tail_ = merged.last;
+          }
+          throw;
+        }
+        prev->next_node = merged.first;
+        prev = merged.last;
+      }
+      tail_ = prev;
+    }
+  }
+
+  void Sort() { Sort(std::less<>()); }
+
+ protected:
+  /*
+   * Делает список пустым, не разрушая элементы и не освобождая узлы
+   * Предназначен для производных классов, память узлов которых освобождается
+   * ресурсом целиком, а элементы не требуют разрушения
+   */
+  void AbandonNodes() noexcept {
+    head_.next_node = nullptr;
+    tail_ = &head_;
+    size_ = 0;
+    spare_nodes_ = nullptr;
+    spare_count_ = 0;
+  }
+
+ private:
+  // Размещает узел аллокатором списка и конструирует в нём значение из args
+  // Если конструктор значения выбросит исключение, память узла освобождается
+  // Узел берётся из запаса, созданного Reserve, если он не пуст
+  template <typename... Args>
+  Node *CreateNode(Node *next, Args &&...args) {
+    Node *node = spare_nodes_ != nullptr ? PopSpare() : AllocateNode();
+    try {
+      NodeTraits::construct(alloc_, node, next, std::forward<Args>(args)...);
+    } catch (...) {
+      PushSpare(node);
+      throw;
+    }
+    return node;
+  }
+
+  Node *AllocateNode() {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+    RecordNodeAllocation();
+    return node;
+  }
+
+  void PushSpare(Node *node) noexcept {
+    spare_nodes_ = ::new (static_cast<void *>(node)) SpareNode{spare_nodes_};
+    ++spare_count_;
+  }
+
+  Node *PopSpare() noexcept {
+    SpareNode *spare = spare_nodes_;
+    spare_nodes_ = spare->next;
+    --spare_count_;
+    return reinterpret_cast<Node *>(spare);
+  }
+
+  // Возвращает аллокатору count узлов из вершины запаса
+  void ReleaseSpares(size_t count) noexcept {
+    for (; count != 0; --count) {
+      NodeTraits::deallocate(alloc_, PopSpare(), 1);
+      RecordNodeDeallocation();
+    }
+  }
+
+  // Измеряет не более count переходов, начиная со звена from
+  ListLocality MeasureLinks(const NodeBase *from, size_t count) const noexcept {
+    ListLocality locality;
+    for (; count != 0 && from->next_node != nullptr; --count) {
+      if (from != &head_) {
+        locality.RecordLink(from, from->next_node);
+      }
+      from = from->next_node;
+    }
+    return locality;
+  }
+
+  // Создаёт цепочку узлов с копиями элементов [first, last)
+  // Если при создании элемента будет выброшено исключение, созданные узлы
+  // удаляются
+  template <typename InputIt>
+  Chain BuildChain(InputIt first, InputIt last) {
+    Chain chain;
+    try {
+      for (; first != last; ++first) {
+        AppendToChain(chain, CreateNode(nullptr, *first));
+      }
+    } catch (...) {
+      DestroyChain(chain.first);
+      throw;
+    }
+    return chain;
+  }
+
+  // Разрушает узлы цепочки, начинающейся с first
+  void DestroyChain(Node *first) noexcept {
+    while (first != nullptr) {
+      Node *next = first->next_node;
+      DestroyNode(first);
+      first = next;
+    }
+  }
+
+  // Вставляет цепочку chain после узла pos за время O(1)
+  void LinkChainAfter(NodeBase *pos, const Chain &chain) noexcept {
+    if (chain.first == nullptr) {
+      return;
+    }
+    chain.last->next_node = pos->next_node;
+    pos->next_node = chain.first;
+    if (pos == tail_) {
+      tail_ = chain.last;
+    }
+    size_ += chain.size;
+    RecordSize(size_);
+  }
+
+  // Отсоединяет узлы интервала (before, last) и возвращает их в виде цепочки
+  Chain UnlinkAfter(NodeBase *before, const NodeBase *last) noexcept {
+    Chain chain;
+    if (before->next_node == last) {
+      return chain;
+    }
+    chain.first = before->next_node;
+    chain.last = chain.first;
+    chain.size = 1;
+    while (chain.last->next_node != last) {
+      chain.last = chain.last->next_node;
+      ++chain.size;
+    }
+    before->next_node = chain.last->next_node;
+    if (tail_ == chain.last) {
+      tail_ = before;
+    }
+    size_ -= chain.size;
+    chain.last->next_node = nullptr;
+    return chain;
+  }
+
+  // Добавляет отсоединённый узел node в конец цепочки chain
+  static void AppendToChain(Chain &chain, Node *node) noexcept {
+    node->next_node = nullptr;
+    if (chain.first == nullptr) {
+      chain.first = node;
+    } else {
+      chain.last->next_node = node;
+    }
+    chain.last = node;
+    ++chain.size;
+  }
+
+  // Отсоединяет узл prev->next_node, сохраняя корректность хвоста и размера
+  // списка, и добавляет его в конец цепочки removed
+  void UnlinkNextInto(NodeBase *prev, Chain &removed) noexcept {
+    Node *target = prev->next_node;
+    prev->next_node = target->next_node;
+    if (target == tail_) {
+      tail_ = prev;
+    }
+    --size_;
+    AppendToChain(removed, target);
+  }
+
+  // Отсоединяет узлы, значения которых удовлетворяют pred, в цепочку removed
+  // Если pred выбросит исключение, список останется корректным, а уже
+  // отсоединённые узлы останутся в removed
+  template <typename Predicate>
+  void UnlinkIf(Predicate &pred, Chain &removed) {
+    NodeBase *prev = &head_;
+    while (prev->next_node != nullptr) {
+      if (pred(prev->next_node->value)) {
+        UnlinkNextInto(prev, removed);
+      } else {
+        prev = prev->next_node;
+      }
+    }
+  }
+
+  // Отсоединяет в цепочку removed узлы, значения которых равны значению
+  // предыдущего оставшегося узла
+  template <typename BinaryPredicate>
+  void UnlinkDuplicates(BinaryPredicate &pred, Chain &removed) {
+    Node *prev = head_.next_node;
+    if (prev == nullptr) {
+      return;
+    }
+    while (prev->next_node != nullptr) {
+      if (pred(prev->value, prev->next_node->value)) {
+        UnlinkNextInto(prev, removed);
+      } else {
+        prev = prev->next_node;
+      }
+    }
+  }
+
+  // Отсоединяет от списка все его узлы и возвращает их в виде цепочки
+  Chain DetachAll() noexcept {
+    Chain chain{head_.next_node,
+                IsEmpty() ? nullptr : static_cast<Node *>(tail_), size_};
+    head_.next_node = nullptr;
+    tail_ = &head_;
+    size_ = 0;
+    return chain;
+  }
+
+  // Отделяет от начала цепочки rest не более count узлов и возвращает их в
+  // виде отдельной цепочки. rest указывает на оставшиеся узлы
+  static Chain TakeRun(Node *&rest, size_t count) noexcept {
+    Chain run;
+    run.first = rest;
+    while (rest != nullptr && run.size < count) {
+      run.last = rest;
+      rest = rest->next_node;
+      ++run.size;
+    }
+    if (run.last != nullptr) {
+      run.last->next_node = nullptr;
+    }
+    return run;
+  }
+
+  /*
+   * Устойчиво сливает отсортированные цепочки, заканчивающиеся nullptr, в
+   * цепочку merged. Из равных элементов первыми идут элементы lhs
+   * Если comp выбросит исключение, merged всё равно содержит все узлы обеих
+   * цепочек: уже слитые, затем оставшиеся узлы lhs и rhs
+   */
+  template <typename Compare>
+  static void MergeChains(const Chain &lhs, const Chain &rhs, Compare &comp,
+                          Chain &merged) {
+    if (lhs.first == nullptr) {
+      merged = rhs;
+      return;
+    }
+    if (rhs.first == nullptr) {
+      merged = lhs;
+      return;
+    }
+    Node *a = lhs.first;
+    Node *b = rhs.first;
+    merged = Chain{nullptr, nullptr, lhs.size + rhs.size};
+    Node **link = &merged.first;
+    try {
+      while (a != nullptr && b != nullptr) {
+        if (comp(b->value, a->value)) {
+          *link = b;
+          b = b->next_node;
+        } else {
+          *link = a;
+          a = a->next_node;
+        }
+        link = &(*link)->next_node;
+      }
+    } catch (...) {
+      // Сравнение выбрасывается, только пока обе цепочки не пусты
+      *link = a;
+      lhs.last->next_node = b;
+      merged.last = rhs.last;
+      throw;
+    }
+    // Оставшиеся узлы одной из цепочек уже упорядочены
+    if (a != nullptr) {
+      *link = a;
+      merged.last = lhs.last;
+    } else {
+      *link = b;
+      merged.last = rhs.last;
+    }
+  }
+
+  // Удаляет все узлы, следующие за last, делая его последним узлом списка
+  void EraseTail(NodeBase *last) noexcept {
+    while (last->next_node != nullptr) {
+      Node *target = last->next_node;
+      last->next_node = target->next_node;
+      if constexpr (kListPrefetchEnabled) {
+        detail::PrefetchForRead(target->next_node);
+      }
+      DestroyNode(target);
+      size_--;
+    }
+    tail_ = last;
+  }
+
+  // Разрушает значение узла и возвращает память аллокатору списка
+  void DestroyNode(Node *node) noexcept {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+    RecordNodeDeallocation();
+  }
+
+  // Обменивает цепочки и запасы узлов двух списков, не затрагивая аллокаторы
+  void SwapNodes(SingleLinkedList &other) noexcept {
+    std::swap(head_.next_node, other.head_.next_node);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    std::swap(spare_nodes_, other.spare_nodes_);
+    std::swap(spare_count_, other.spare_count_);
+    // У пустого списка хвост указывает на собственный фиктивный узел
+    if (head_.next_node == nullptr) {
+      tail_ = &head_;
+    }
+    if (other.head_.next_node == nullptr) {
+      other.tail_ = &other.head_;
+    }
+  }
+
+  // Переносит все узлы списка other в конец текущего списка за время O(1)
+  // Аллокаторы списков должны быть равны
+  void AppendNodesOf(SingleLinkedList &other) noexcept {
+    if (other.IsEmpty()) {
+      return;
+    }
+    tail_->next_node = other.head_.next_node;
+    tail_ = other.tail_;
+    size_ += other.size_;
+    RecordSize(size_);
+    other.head_.next_node = nullptr;
+    other.tail_ = &other.head_;
+    other.size_ = 0;
+  }
+
+  NodeAllocator alloc_;
+  // Фиктивный узел, используется для вставки "перед первым элементом"
+  NodeBase head_;
+  // Последний узел списка. У пустого списка указывает на head_
+  NodeBase *tail_ = &head_;
+  size_t size_;
+  // Запас узлов, выделенных Reserve, но ещё не занятых элементами
+  SpareNode *spare_nodes_ = nullptr;
+  size_t spare_count_ = 0;
+};
+
+template <typename Type, typename Allocator>
+void swap(SingleLinkedList<Type, Allocator> &lhs,
+          SingleLinkedList<Type, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator>
+bool operator==(const SingleLinkedList<Type, Allocator> &lhs,
+                const SingleLinkedList<Type, Allocator> &rhs) {
+  lhs.RecordComparison();
+  rhs.RecordComparison();
+  if (lhs.GetSize() != rhs.GetSize()) {
+    return false;
+  }
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Type, typename Allocator>
+bool operator!=(const SingleLinkedList<Type, Allocator> &lhs,
+                const SingleLinkedList<Type, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+// Выполняет лексикографическое сравнение списков за один проход
+template <typename Type, typename Allocator>
+detail::ThreeWayResult CompareThreeWay(
+    const SingleLinkedList<Type, Allocator> &lhs,
+    const SingleLinkedList<Type, Allocator> &rhs) {
+  lhs.RecordComparison();
+  rhs.RecordComparison();
+  return detail::CompareThreeWay(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename Type, typename Allocator>
+bool operator<(const SingleLinkedList<Type, Allocator> &lhs,
+               const SingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator<=(const SingleLinkedList<Type, Allocator> &lhs,
+                const SingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator>(const SingleLinkedList<Type, Allocator> &lhs,
+               const SingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, typename Allocator>
+bool operator>=(const SingleLinkedList<Type, Allocator> &lhs,
+                const SingleLinkedList<Type, Allocator> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+namespace std {
+// Хеш списка зависит от порядка элементов и вычисляется за O(N)
+template <typename Type, typename Allocator>
+struct hash<SingleLinkedList<Type, Allocator>> {
+  size_t operator()(const SingleLinkedList<Type, Allocator> &list) const {
+    return detail::HashRange(list.begin(), list.end(), list.GetSize());
+  }
+};
+}  // namespace std
+
+namespace pmr {
+// Односвязный список, узлы которого размещаются в std::pmr::memory_resource
+template <typename Type>
+using SingleLinkedList =
+    ::SingleLinkedList<Type, std::pmr::polymorphic_allocator<Type>>;
+}  // namespace pmr
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <utility>
+
+#include "inline_node_resource.h"
+#include "single_linked_list.h"
+
+namespace detail {
+
+template <typename Type, size_t kInlineNodes>
+using SmallListResource =
+    InlineNodeResource<pmr::SingleLinkedList<Type>::kNodeSize,
+                       pmr::SingleLinkedList<Type>::kNodeAlignment,
+                       kInlineNodes>;
+
+// Владелец ячеек для узлов. Базовый класс SmallSingleLinkedList, стоящий
+// перед списком, чтобы ячейки были созданы раньше списка и разрушены позже
+// него
+template <typename Type, size_t kInlineNodes>
+struct SmallListHolder {
+  explicit SmallListHolder(std::pmr::memory_resource *upstream)
+      : resource(upstream) {}
+
+  SmallListResource<Type, kInlineNodes> resource;
+};
+
+}  // namespace detail
+
+/*
+ * Односвязный список, первые kInlineNodes узлов которого размещаются внутри
+ * объекта списка. Короткий список не обращается к динамической памяти, а
+ * узлы сверх kInlineNodes запрашиваются у вышестоящего ресурса
+ * Освобождённые ячейки переиспользуются следующими вставками
+ * Ячейки принадлежат списку, поэтому перемещение и перемещающее
+ * присваивание переносят элементы по одному за время O(N)
+ * Список наследует pmr::SingleLinkedList закрыто и не предоставляет
+ * операций, передающих узлы другому списку (swap, SpliceAfter, Merge), а
+ * также преобразования к pmr::SingleLinkedList: иначе перемещение в базовый
+ * список забрало бы узлы, размещённые в ячейках этого списка
+ * Compact не предоставляется: новые узлы запрашивались бы до освобождения
+ * занятых ячеек, поэтому уплотнение переносило бы элементы из ячеек в
+ * память вышестоящего ресурса
+ */
+template <typename Type, size_t kInlineNodes = 8>
+class SmallSingleLinkedList
+    : private detail::SmallListHolder<Type, kInlineNodes>,
+      private pmr::SingleLinkedList<Type> {
+  using Holder = detail::SmallListHolder<Type, kInlineNodes>;
+  using Base = pmr::SingleLinkedList<Type>;
+
+  template <typename T, size_t k>
+  friend bool operator==(const SmallSingleLinkedList<T, k> &lhs,
+                         const SmallSingleLinkedList<T, k> &rhs);
+  template <typename T, size_t k>
+  friend detail::ThreeWayResult CompareThreeWay(
+      const SmallSingleLinkedList<T, k> &lhs,
+      const SmallSingleLinkedList<T, k> &rhs);
+
+ public:
+  using typename Base::allocator_type;
+  using typename Base::const_reference;
+  using typename Base::ConstIterator;
+  using typename Base::Iterator;
+  using typename Base::reference;
+  using typename Base::value_type;
+
+  using Base::begin;
+  using Base::cbegin;
+  using Base::cend;
+  using Base::end;
+
+  using Base::before_begin;
+  using Base::cbefore_begin;
+
+  using Base::get_allocator;
+  using Base::GetStats;
+  using Base::ResetStats;
+
+  using Base::GetSize;
+  using Base::IsEmpty;
+
+  using Base::ForEach;
+
+  using Base::EmplaceBack;
+  using Base::EmplaceFront;
+  using Base::PushBack;
+  using Base::PushFront;
+
+  using Base::AppendFrom;
+  using Base::AppendRange;
+  using Base::Assign;
+  using Base::kDefaultAppendBatch;
+
+  using Base::GetCapacity;
+  using Base::Reserve;
+  using Base::ShrinkToFit;
+
+  using Base::MeasureLocality;
+
+  using Base::Clear;
+  using Base::EmplaceAfter;
+  using Base::InsertAfter;
+  using Base::PopFront;
+
+  using Base::Sort;
+
+  explicit SmallSingleLinkedList(
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : Holder(upstream), Base(&this->resource) {}
+
+  SmallSingleLinkedList(std::initializer_list<Type> values)
+      : SmallSingleLinkedList() {
+    Base::Assign(values);
+  }
+
+  // Копия размещает узлы в собственных ячейках
+  SmallSingleLinkedList(const SmallSingleLinkedList &other)
+      : Holder(other.resource.GetUpstream()),
+        Base(other, &this->resource) {}
+
+  // Элементы other перемещаются в собственные узлы, other остаётся пустым
+  SmallSingleLinkedList(SmallSingleLinkedList &&other)
+      : SmallSingleLinkedList(other.resource.GetUpstream()) {
+    Base::operator=(std::move(other));
+  }
+
+  SmallSingleLinkedList &operator=(const SmallSingleLinkedList &rhs) {
+    Base::operator=(rhs);
+    return *this;
+  }
+
+  SmallSingleLinkedList &operator=(SmallSingleLinkedList &&rhs) {
+    Base::operator=(std::move(rhs));
+    return *this;
+  }
+
+  // Удаление элементов. Перегрузки, переносящие удалённые узлы в другой
+  // список, не предоставляются
+  Iterator EraseAfter(ConstIterator pos) noexcept {
+    return Base::EraseAfter(pos);
+  }
+
+  size_t EraseAfter(ConstIterator first, ConstIterator last) noexcept {
+    return Base::EraseAfter(first, last);
+  }
+
+  template <typename Predicate>
+  size_t RemoveIf(Predicate pred) {
+    return Base::RemoveIf(std::move(pred));
+  }
+
+  size_t Remove(const Type &value) { return Base::Remove(value); }
+
+  template <typename BinaryPredicate>
+  size_t Unique(BinaryPredicate pred) {
+    return Base::Unique(std::move(pred));
+  }
+
+  size_t Unique() { return Base::Unique(); }
+
+  [[nodiscard]] static constexpr size_t GetInlineCapacity() noexcept {
+    return kInlineNodes;
+  }
+
+  // Возвращает количество узлов, размещённых внутри объекта списка
+  [[nodiscard]] size_t GetInlineCount() const noexcept {
+    return this->resource.GetInlineCount();
+  }
+};
+
+template <typename Type, size_t kInlineNodes>
+bool operator==(const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+                const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return static_cast<const pmr::SingleLinkedList<Type> &>(lhs) ==
+         static_cast<const pmr::SingleLinkedList<Type> &>(rhs);
+}
+
+template <typename Type, size_t kInlineNodes>
+bool operator!=(const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+                const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, size_t kInlineNodes>
+detail::ThreeWayResult CompareThreeWay(
+    const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+    const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return CompareThreeWay(static_cast<const pmr::SingleLinkedList<Type> &>(lhs),
+                         static_cast<const pmr::SingleLinkedList<Type> &>(rhs));
+}
+
+template <typename Type, size_t kInlineNodes>
+bool operator<(const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+               const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t kInlineNodes>
+bool operator<=(const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+                const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t kInlineNodes>
+bool operator>(const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+               const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t kInlineNodes>
+bool operator>=(const SmallSingleLinkedList<Type, kInlineNodes> &lhs,
+                const SmallSingleLinkedList<Type, kInlineNodes> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "list_compare.h"
+
+namespace detail {
+
+// Наименьший беззнаковый тип, вмещающий индексы узлов и два особых индекса
+template <size_t kCapacity>
+using StaticListIndex = std::conditional_t<
+    (kCapacity < std::numeric_limits<uint8_t>::max()), uint8_t,
+    std::conditional_t<(kCapacity < std::numeric_limits<uint16_t>::max()),
+                       uint16_t, uint32_t>>;
+
+// Элементы, которые можно хранить в массиве готовых объектов и
+// присваивать при вставке. Такой список имеет тривиальный деструктор и
+// может использоваться в константных выражениях
+template <typename Type>
+inline constexpr bool kIsStaticListLiteral =
+    std::is_trivially_destructible_v<Type> &&
+    std::is_default_constructible_v<Type> && std::is_move_assignable_v<Type>;
+
+// Связи узлов списка. Узлы хранятся в массиве и ссылаются друг на друга
+// индексами
+template <size_t kCapacity>
+struct StaticListLinks {
+  using Index = StaticListIndex<kCapacity>;
+
+  // Индекс, обозначающий отсутствие узла (end())
+  static constexpr Index kNull = static_cast<Index>(kCapacity);
+  // Индекс фиктивного узла перед первым элементом (before_begin())
+  static constexpr Index kHead = static_cast<Index>(kCapacity + 1);
+
+  Index next[kCapacity]{};
+  Index head = kNull;
+  // Индекс последнего узла. У пустого списка равен kHead
+  Index tail = kHead;
+  // Первый узел списка свободных
+  Index free = kNull;
+  // Количество узлов в начале массива, которые когда-либо использовались
+  Index used = 0;
+  size_t size = 0;
+};
+
+// Узлы с элементами, которые присваиваются при вставке и не разрушаются
+template <typename Type, size_t kCapacity,
+          bool kLiteral = kIsStaticListLiteral<Type>>
+struct StaticListState : StaticListLinks<kCapacity> {
+  constexpr Type &Get(size_t index) noexcept { return values[index]; }
+  constexpr const Type &Get(size_t index) const noexcept {
+    return values[index];
+  }
+
+  template <typename... Args>
+  constexpr void Construct(size_t index, Args &&...args) {
+    values[index] = Type(std::forward<Args>(args)...);
+  }
+
+  constexpr void Destroy(size_t) noexcept {}
+
+  Type values[kCapacity]{};
+};
+
+// Узлы с неинициализированной памятью, в которой элементы конструируются
+// при вставке и разрушаются при удалении
+template <typename Type, size_t kCapacity>
+struct StaticListState<Type, kCapacity, false> : StaticListLinks<kCapacity> {
+  struct Slot {
+    alignas(Type) unsigned char bytes[sizeof(Type)];
+  };
+
+  StaticListState() = default;
+  StaticListState(const StaticListState &) = delete;
+  StaticListState &operator=(const StaticListState &) = delete;
+
+  ~StaticListState() {
+    for (size_t i = this->head; i != this->kNull; i = this->next[i]) {
+      Destroy(i);
+    }
+  }
+
+  Type &Get(size_t index) noexcept {
+    return *std::launder(reinterpret_cast<Type *>(slots[index].bytes));
+  }
+  const Type &Get(size_t index) const noexcept {
+    return *std::launder(reinterpret_cast<const Type *>(slots[index].bytes));
+  }
+
+  template <typename... Args>
+  void Construct(size_t index, Args &&...args) {
+    ::new (static_cast<void *>(slots[index].bytes))
+        Type(std::forward<Args>(args)...);
+  }
+
+  void Destroy(size_t index) noexcept { Get(index).~Type(); }
+
+  Slot slots[kCapacity];
+};
+
+}  // namespace detail
+
+/*
+ * Односвязный список вместимостью не более kCapacity элементов, узлы
+ * которого хранятся внутри самого объекта списка. Список не обращается к
+ * динамической памяти, а его узлы ссылаются друг на друга индексами
+ * наименьшего подходящего размера. Удалённые узлы переиспользуются
+ * Вставка в заполненный список выбрасывает std::length_error
+ * Если элементы тривиально разрушаемы, конструируемы по умолчанию и
+ * допускают присваивание (числа, std::string_view, простые структуры),
+ * они хранятся в массиве готовых объектов и присваиваются при вставке
+ * Такой список имеет тривиальный деструктор, и все его операции constexpr:
+ * списки можно строить и обходить при компиляции. Остальные элементы
+ * конструируются в неинициализированной памяти при вставке и разрушаются
+ * при удалении
+ * Копирование и перемещение выполняются поэлементно за время O(N)
+ */
+template <typename Type, size_t kCapacity>
+class StaticSingleLinkedList {
+  using State = detail::StaticListState<Type, kCapacity>;
+  using Index = typename State::Index;
+
+  static_assert(kCapacity > 0, "StaticSingleLinkedList capacity must be > 0");
+  static_assert(kCapacity < std::numeric_limits<uint32_t>::max() - 1,
+                "StaticSingleLinkedList capacity is too large");
+
+  static constexpr Index kNull = State::kNull;
+  static constexpr Index kHead = State::kHead;
+
+  template <typename ValueType>
+  class BasicIterator {
+    friend class StaticSingleLinkedList;
+    using ListPointer =
+        std::conditional_t<std::is_const_v<ValueType>,
+                           const StaticSingleLinkedList *,
+                           StaticSingleLinkedList *>;
+
+    constexpr BasicIterator(ListPointer list, Index index) noexcept
+        : list_(list), index_(index) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    constexpr BasicIterator() = default;
+
+    // Конвертирующий конструктор/конструктор копирования
+    constexpr BasicIterator(const BasicIterator<Type> &other) noexcept
+        : list_(other.list_), index_(other.index_) {}
+
+    constexpr BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    // Итераторы end() разных списков равны, как и в SingleLinkedList
+    [[nodiscard]] constexpr bool operator==(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return index_ == rhs.index_ && (index_ == kNull || list_ == rhs.list_);
+    }
+
+    [[nodiscard]] constexpr bool operator!=(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    [[nodiscard]] constexpr bool operator==(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return index_ == rhs.index_ && (index_ == kNull || list_ == rhs.list_);
+    }
+
+    [[nodiscard]] constexpr bool operator!=(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    constexpr BasicIterator &operator++() noexcept {
+      index_ = list_->NextOf(index_);
+      return *this;
+    }
+
+    constexpr BasicIterator operator++(int) noexcept {
+      BasicIterator prev(*this);
+      ++(*this);
+      return prev;
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+      return list_->state_.Get(index_);
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+      return &list_->state_.Get(index_);
+    }
+
+   private:
+    ListPointer list_ = nullptr;
+    Index index_ = kNull;
+  };
+
+ public:
+  using value_type = Type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using Iterator = BasicIterator<Type>;
+  using ConstIterator = BasicIterator<const Type>;
+
+  // Наибольшее количество элементов списка
+  static constexpr size_t kMaxSize = kCapacity;
+
+  constexpr StaticSingleLinkedList() = default;
+
+  constexpr StaticSingleLinkedList(std::initializer_list<Type> values) {
+    for (const Type &value : values) {
+      PushBack(value);
+    }
+  }
+
+  // Копия содержит элементы other в том же порядке, но её узлы занимают
+  // начало массива
+  constexpr StaticSingleLinkedList(const StaticSingleLinkedList &other) {
+    for (const Type &value : other) {
+      PushBack(value);
+    }
+  }
+
+  // Перемещает элементы other по одному. other остаётся пустым
+  constexpr StaticSingleLinkedList(StaticSingleLinkedList &&other) noexcept(
+      std::is_nothrow_move_constructible_v<Type>) {
+    for (Type &value : other) {
+      PushBack(std::move(value));
+    }
+    other.Clear();
+  }
+
+  // Если копирование элемента выбросит исключение, список останется
+  // корректным, но будет содержать только часть элементов rhs
+  constexpr StaticSingleLinkedList &operator=(
+      const StaticSingleLinkedList &rhs) {
+    if (this != &rhs) {
+      Clear();
+      for (const Type &value : rhs) {
+        PushBack(value);
+      }
+    }
+    return *this;
+  }
+
+  constexpr StaticSingleLinkedList &operator=(
+      StaticSingleLinkedList &&rhs) noexcept(
+      std::is_nothrow_move_constructible_v<Type>) {
+    if (this != &rhs) {
+      Clear();
+      for (Type &value : rhs) {
+        PushBack(std::move(value));
+      }
+      rhs.Clear();
+    }
+    return *this;
+  }
+
+  [[nodiscard]] constexpr Iterator begin() noexcept {
+    return Iterator(this, state_.head);
+  }
+  [[nodiscard]] constexpr Iterator end() noexcept {
+    return Iterator(this, kNull);
+  }
+  [[nodiscard]] constexpr ConstIterator begin() const noexcept {
+    return cbegin();
+  }
+  [[nodiscard]] constexpr ConstIterator end() const noexcept { return cend(); }
+  [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
+    return ConstIterator(this, state_.head);
+  }
+  [[nodiscard]] constexpr ConstIterator cend() const noexcept {
+    return ConstIterator(this, kNull);
+  }
+
+  [[nodiscard]] constexpr Iterator before_begin() noexcept {
+    return Iterator(this, kHead);
+  }
+  [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+    return ConstIterator(this, kHead);
+  }
+  [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+    return cbefore_begin();
+  }
+
+  [[nodiscard]] constexpr size_t GetSize() const noexcept {
+    return state_.size;
+  }
+
+  [[nodiscard]] constexpr bool IsEmpty() const noexcept {
+    return state_.size == 0;
+  }
+
+  [[nodiscard]] static constexpr size_t GetCapacity() noexcept {
+    return kCapacity;
+  }
+
+  constexpr void PushFront(const Type &value) { EmplaceFront(value); }
+  constexpr void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  template <typename... Args>
+  constexpr Type &EmplaceFront(Args &&...args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+  }
+
+  constexpr void PushBack(const Type &value) { EmplaceBack(value); }
+  constexpr void PushBack(Type &&value) { EmplaceBack(std::move(value)); }
+
+  template <typename... Args>
+  constexpr Type &EmplaceBack(Args &&...args) {
+    return *EmplaceAfter(ConstIterator(this, state_.tail),
+                         std::forward<Args>(args)...);
+  }
+
+  constexpr Iterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  constexpr Iterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  /*
+   * Конструирует элемент после pos и возвращает итератор на него
+   * Если список заполнен, выбрасывает std::length_error. Свободный узел
+   * занимается только после того, как элемент сконструирован, поэтому
+   * исключение при конструировании оставляет список без изменений
+   */
+  template <typename... Args>
+  constexpr Iterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    assert(pos.list_ == this && pos.index_ != kNull);
+    const bool reuse = state_.free != kNull;
+    const Index index = reuse ? state_.free : state_.used;
+    if (index == kCapacity) {
+      throw std::length_error("StaticSingleLinkedList is full");
+    }
+    state_.Construct(index, std::forward<Args>(args)...);
+    if (reuse) {
+      state_.free = state_.next[index];
+    } else {
+      ++state_.used;
+    }
+    Index &link = LinkOf(pos.index_);
+    state_.next[index] = link;
+    link = index;
+    if (state_.tail == pos.index_) {
+      state_.tail = index;
+    }
+    ++state_.size;
+    return Iterator(this, index);
+  }
+
+  constexpr void PopFront() noexcept { EraseAfter(cbefore_begin()); }
+
+  // Удаляет элемент, следующий за pos, и возвращает итератор на элемент,
+  // следующий за удалённым. Узел удалённого элемента становится свободным
+  constexpr Iterator EraseAfter(ConstIterator pos) noexcept {
+    assert(pos.list_ == this && NextOf(pos.index_) != kNull);
+    Index &link = LinkOf(pos.index_);
+    const Index target = link;
+    link = state_.next[target];
+    if (state_.tail == target) {
+      state_.tail = pos.index_;
+    }
+    state_.Destroy(target);
+    state_.next[target] = state_.free;
+    state_.free = target;
+    --state_.size;
+    return Iterator(this, link);
+  }
+
+  constexpr void Clear() noexcept {
+    for (Index i = state_.head; i != kNull; i = state_.next[i]) {
+      state_.Destroy(i);
+    }
+    state_.head = kNull;
+    state_.tail = kHead;
+    state_.free = kNull;
+    state_.used = 0;
+    state_.size = 0;
+  }
+
+  // Обменивает содержимое списков поэлементно за время O(N)
+  constexpr void swap(StaticSingleLinkedList &other) noexcept(
+      std::is_nothrow_move_constructible_v<Type>) {
+    StaticSingleLinkedList tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  constexpr Index NextOf(Index index) const noexcept {
+    return index == kHead ? state_.head : state_.next[index];
+  }
+
+  // Возвращает ссылку на поле, хранящее индекс узла, следующего за index
+  constexpr Index &LinkOf(Index index) noexcept {
+    return index == kHead ? state_.head : state_.next[index];
+  }
+
+  State state_;
+};
+
+template <typename Type, size_t kCapacity>
+constexpr void swap(StaticSingleLinkedList<Type, kCapacity> &lhs,
+                    StaticSingleLinkedList<Type, kCapacity> &rhs) noexcept(
+    std::is_nothrow_move_constructible_v<Type>) {
+  lhs.swap(rhs);
+}
+
+template <typename Type, size_t kCapacity>
+constexpr bool operator==(const StaticSingleLinkedList<Type, kCapacity> &lhs,
+                          const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  if (lhs.GetSize() != rhs.GetSize()) {
+    return false;
+  }
+  for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r) {
+    if (!(*l == *r)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Type, size_t kCapacity>
+constexpr bool operator!=(const StaticSingleLinkedList<Type, kCapacity> &lhs,
+                          const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, size_t kCapacity>
+constexpr detail::ThreeWayResult CompareThreeWay(
+    const StaticSingleLinkedList<Type, kCapacity> &lhs,
+    const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  return detail::CompareThreeWay(lhs.begin(), lhs.end(), rhs.begin(),
+                                 rhs.end());
+}
+
+template <typename Type, size_t kCapacity>
+constexpr bool operator<(const StaticSingleLinkedList<Type, kCapacity> &lhs,
+                         const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t kCapacity>
+constexpr bool operator<=(const StaticSingleLinkedList<Type, kCapacity> &lhs,
+                          const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t kCapacity>
+constexpr bool operator>(const StaticSingleLinkedList<Type, kCapacity> &lhs,
+                         const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t kCapacity>
+constexpr bool operator>=(const StaticSingleLinkedList<Type, kCapacity> &lhs,
+                          const StaticSingleLinkedList<Type, kCapacity> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}
@@ -0,0 +1,685 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "list_compare.h"
+#include "simd_kernels.h"
+
+/*
+ * Односвязный список, хранящий до ChunkSize элементов в каждом узле
+ * Элементы одного узла лежат в памяти подряд, поэтому обход списка реже
+ * переходит по указателям. Интерфейс совпадает с SingleLinkedList
+ * В отличие от SingleLinkedList вставка и удаление элемента делают
+ * недействительными итераторы и ссылки на элементы затронутых узлов
+ * Для сохранения строгой гарантии при вставке в середину узла перемещающие
+ * конструктор и присваивание Type не должны выбрасывать исключений
+ */
+template <typename Type, size_t ChunkSize = 16,
+          typename Allocator = std::allocator<Type>>
+class UnrolledSingleLinkedList {
+  static_assert(ChunkSize >= 2, "Chunk must hold at least two elements");
+
+  // Заголовок узла. Фиктивный узел списка состоит только из заголовка
+  struct ChunkBase {
+    ChunkBase *next_chunk = nullptr;
+    size_t count = 0;
+  };
+
+  // Узел списка с местом для ChunkSize элементов
+  struct Chunk : ChunkBase {
+    Type *Values() noexcept {
+      return std::launder(reinterpret_cast<Type *>(storage));
+    }
+    const Type *Values() const noexcept {
+      return std::launder(reinterpret_cast<const Type *>(storage));
+    }
+    alignas(Type) unsigned char storage[sizeof(Type) * ChunkSize];
+  };
+
+  template <typename ValueType>
+  class BasicIterator {
+    friend class UnrolledSingleLinkedList;
+    // Итератор ссылается на элемент index узла chunk
+    BasicIterator(ChunkBase *chunk, size_t index) noexcept
+        : chunk_(chunk), index_(index) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType *;
+    using reference = ValueType &;
+
+    BasicIterator() = default;
+
+    // Конвертирующий конструктор/конструктор копирования
+    BasicIterator(const BasicIterator<Type> &other) noexcept
+        : chunk_(other.chunk_), index_(other.index_) {}
+
+    BasicIterator &operator=(const BasicIterator &rhs) = default;
+
+    [[nodiscard]] bool operator==(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return chunk_ == rhs.chunk_ && index_ == rhs.index_;
+    }
+
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<const Type> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    [[nodiscard]] bool operator==(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return chunk_ == rhs.chunk_ && index_ == rhs.index_;
+    }
+
+    [[nodiscard]] bool operator!=(
+        const BasicIterator<Type> &rhs) const noexcept {
+      return !(*this == rhs);
+    }
+
+    // Переходит к следующему элементу узла, а после последнего элемента —
+    // к первому элементу следующего узла. У фиктивного узла элементов нет,
+    // поэтому инкремент before_begin() даёт begin()
+    BasicIterator &operator++() noexcept {
+      if (index_ + 1 < chunk_->count) {
+        ++index_;
+      } else {
+        chunk_ = chunk_->next_chunk;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    BasicIterator operator++(int) noexcept {
+      BasicIterator prev(*this);
+      ++(*this);
+      return prev;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+      return static_cast<Chunk *>(chunk_)->Values()[index_];
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+      return &static_cast<Chunk *>(chunk_)->Values()[index_];
+    }
+
+   private:
+    ChunkBase *chunk_ = nullptr;
+    size_t index_ = 0;
+  };
+
+  using ChunkAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+  using ChunkTraits = std::allocator_traits<ChunkAllocator>;
+  static_assert(std::is_same_v<typename ChunkTraits::pointer, Chunk *>,
+                "Allocator must use raw pointers");
+
+  // Равенство значений скалярного типа без битов заполнения совпадает с
+  // равенством их байтового представления. Для классов это неверно:
+  // operator== может сравнивать не все поля
+  static constexpr bool kIsBitwiseComparable =
+      (std::is_integral_v<Type> || std::is_enum_v<Type> ||
+       std::is_pointer_v<Type>) &&
+      std::has_unique_object_representations_v<Type>;
+
+ public:
+  using value_type = Type;
+  using allocator_type = Allocator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using Iterator = BasicIterator<Type>;
+  using ConstIterator = BasicIterator<const Type>;
+
+  // Количество элементов, помещающихся в один узел
+  static constexpr size_t kChunkSize = ChunkSize;
+
+  UnrolledSingleLinkedList() = default;
+
+  explicit UnrolledSingleLinkedList(const Allocator &alloc) : alloc_(alloc) {}
+
+  UnrolledSingleLinkedList(std::initializer_list<Type> values,
+                           const Allocator &alloc = Allocator())
+      : alloc_(alloc) {
+    try {
+      for (const Type &value : values) {
+        PushBack(value);
+      }
+    } catch (...) {
+      Clear();
+      throw;
+    }
+  }
+
+  UnrolledSingleLinkedList(const UnrolledSingleLinkedList &other)
+      : UnrolledSingleLinkedList(
+            other, Allocator(ChunkTraits::select_on_container_copy_construction(
+                       other.alloc_))) {}
+
+  // Копирует элементы other в узлы, размещаемые аллокатором alloc
+  UnrolledSingleLinkedList(const UnrolledSingleLinkedList &other,
+                           const Allocator &alloc)
+      : alloc_(alloc) {
+    try {
+      for (const Type &value : other) {
+        PushBack(value);
+      }
+    } catch (...) {
+      Clear();
+      throw;
+    }
+  }
+
+  UnrolledSingleLinkedList(UnrolledSingleLinkedList &&other) noexcept
+      : alloc_(other.alloc_) {
+    SwapChunks(other);
+  }
+
+  // Использует идиому copy-and-swap, обеспечивая строгую гарантию
+  // безопасности исключений. Копия размещается аллокатором, который список
+  // будет использовать после присваивания
+  UnrolledSingleLinkedList &operator=(const UnrolledSingleLinkedList &rhs) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if constexpr (ChunkTraits::propagate_on_container_copy_assignment::value) {
+      if (alloc_ != rhs.alloc_) {
+        // Прежние узлы удаляются вместе с tmp прежним аллокатором
+        UnrolledSingleLinkedList tmp(rhs, Allocator(rhs.alloc_));
+        SwapChunks(tmp);
+        std::swap(alloc_, tmp.alloc_);
+        return *this;
+      }
+    }
+    UnrolledSingleLinkedList tmp(rhs, get_allocator());
+    SwapChunks(tmp);
+    return *this;
+  }
+
+  // Если аллокатор не распространяется при перемещении и аллокаторы списков
+  // не равны, элементы rhs перемещаются в новые узлы по одному
+  UnrolledSingleLinkedList &operator=(UnrolledSingleLinkedList &&rhs) noexcept(
+      ChunkTraits::propagate_on_container_move_assignment::value ||
+      ChunkTraits::is_always_equal::value) {
+    if (this == &rhs) {
+      return *this;
+    }
+    if constexpr (ChunkTraits::propagate_on_container_move_assignment::value) {
+      Clear();
+      alloc_ = rhs.alloc_;
+      SwapChunks(rhs);
+    } else {
+      if (alloc_ == rhs.alloc_) {
+        Clear();
+        SwapChunks(rhs);
+      } else {
+        UnrolledSingleLinkedList tmp(get_allocator());
+        for (Type &value : rhs) {
+          tmp.PushBack(std::move(value));
+        }
+        SwapChunks(tmp);
+        rhs.Clear();
+      }
+    }
+    return *this;
+  }
+
+  ~UnrolledSingleLinkedList() { Clear(); }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept {
+    return allocator_type(alloc_);
+  }
+
+  [[nodiscard]] Iterator begin() noexcept {
+    return Iterator(head_.next_chunk, 0);
+  }
+  [[nodiscard]] Iterator end() noexcept { return Iterator(nullptr, 0); }
+  [[nodiscard]] ConstIterator begin() const noexcept { return cbegin(); }
+  [[nodiscard]] ConstIterator end() const noexcept { return cend(); }
+  [[nodiscard]] ConstIterator cbegin() const noexcept {
+    return ConstIterator(head_.next_chunk, 0);
+  }
+  [[nodiscard]] ConstIterator cend() const noexcept {
+    return ConstIterator(nullptr, 0);
+  }
+
+  [[nodiscard]] Iterator before_begin() noexcept { return Iterator(&head_, 0); }
+  [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+    return ConstIterator(const_cast<ChunkBase *>(&head_), 0);
+  }
+  [[nodiscard]] ConstIterator before_begin() const noexcept {
+    return cbefore_begin();
+  }
+
+  [[nodiscard]] size_t GetSize() const noexcept { return size_; }
+
+  [[nodiscard]] bool IsEmpty() const noexcept { return size_ == 0; }
+
+  void PushFront(const Type &value) { EmplaceFront(value); }
+  void PushFront(Type &&value) { EmplaceFront(std::move(value)); }
+
+  template <typename... Args>
+  Type &EmplaceFront(Args &&...args) {
+    return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+  }
+
+  void PushBack(const Type &value) { EmplaceBack(value); }
+  void PushBack(Type &&value) { EmplaceBack(std::move(value)); }
+
+  // Добавляет элемент в конец списка за время O(1). Новый узел создаётся,
+  // только когда последний узел заполнен
+  template <typename... Args>
+  Type &EmplaceBack(Args &&...args) {
+    if (tail_ == &head_ || tail_->count == ChunkSize) {
+      Chunk *chunk = CreateChunk();
+      try {
+        ConstructValue(chunk, 0, std::forward<Args>(args)...);
+      } catch (...) {
+        DestroyChunk(chunk);
+        throw;
+      }
+      LinkChunkAfter(tail_, chunk);
+    } else {
+      ConstructValue(static_cast<Chunk *>(tail_), tail_->count,
+                     std::forward<Args>(args)...);
+    }
+    ++tail_->count;
+    ++size_;
+    return static_cast<Chunk *>(tail_)->Values()[tail_->count - 1];
+  }
+
+  Iterator InsertAfter(ConstIterator pos, const Type &value) {
+    return EmplaceAfter(pos, value);
+  }
+
+  Iterator InsertAfter(ConstIterator pos, Type &&value) {
+    return EmplaceAfter(pos, std::move(value));
+  }
+
+  /*
+   * Конструирует элемент из аргументов args после элемента, на который
+   * указывает pos. Возвращает итератор на вставленный элемент
+   * Если узел, в который попадает элемент, заполнен, он делится пополам
+   */
+  template <typename... Args>
+  Iterator EmplaceAfter(ConstIterator pos, Args &&...args) {
+    ChunkBase *chunk = pos.chunk_;
+    size_t index = pos.index_ + 1;
+    if (chunk == &head_) {
+      chunk = head_.next_chunk;
+      index = 0;
+      if (chunk == nullptr || chunk->count == ChunkSize) {
+        return EmplaceInNewChunk(&head_, std::forward<Args>(args)...);
+      }
+    }
+    if (chunk->count == ChunkSize) {
+      if (index == ChunkSize) {
+        return EmplaceInNewChunk(chunk, std::forward<Args>(args)...);
+      }
+      // Создаём элемент до разделения узла, чтобы исключение в его
+      // конструкторе оставило список в прежнем состоянии
+      Type value(std::forward<Args>(args)...);
+      Chunk *second = SplitChunk(static_cast<Chunk *>(chunk));
+      if (index > chunk->count) {
+        index -= chunk->count;
+        chunk = second;
+      }
+      return InsertIntoChunk(static_cast<Chunk *>(chunk), index,
+                             std::move(value));
+    }
+    if (index == chunk->count) {
+      ConstructValue(static_cast<Chunk *>(chunk), index,
+                     std::forward<Args>(args)...);
+      ++chunk->count;
+      ++size_;
+      return Iterator(chunk, index);
+    }
+    return InsertIntoChunk(static_cast<Chunk *>(chunk), index,
+                           Type(std::forward<Args>(args)...));
+  }
+
+  void PopFront() noexcept { EraseAfter(cbefore_begin()); }
+
+  /*
+   * Удаляет элемент, следующий за pos.
+   * Возвращает итератор на элемент, следующий за удалённым
+   * Опустевший узел удаляется из списка
+   */
+  Iterator EraseAfter(ConstIterator pos) noexcept {
+    ChunkBase *prev_chunk = pos.chunk_;
+    ChunkBase *chunk = pos.chunk_;
+    size_t index = pos.index_ + 1;
+    if (index >= chunk->count) {
+      chunk = chunk->next_chunk;
+      index = 0;
+    }
+    Type *values = static_cast<Chunk *>(chunk)->Values();
+    for (size_t i = index + 1; i < chunk->count; ++i) {
+      values[i - 1] = std::move(values[i]);
+    }
+    --chunk->count;
+    ChunkTraits::destroy(alloc_, values + chunk->count);
+    --size_;
+
+    if (chunk->count == 0) {
+      // Узел опустел, следовательно, удалённый элемент был в нём
+      // единственным и pos указывает на последний элемент предыдущего узла
+      ChunkBase *next = chunk->next_chunk;
+      prev_chunk->next_chunk = next;
+      if (tail_ == chunk) {
+        tail_ = prev_chunk;
+      }
+      DestroyChunk(static_cast<Chunk *>(chunk));
+      return Iterator(next, 0);
+    }
+    if (index == chunk->count) {
+      return Iterator(chunk->next_chunk, 0);
+    }
+    return Iterator(chunk, index);
+  }
+
+  void Clear() noexcept {
+    while (head_.next_chunk != nullptr) {
+      auto *chunk = static_cast<Chunk *>(head_.next_chunk);
+      head_.next_chunk = chunk->next_chunk;
+      Type *values = chunk->Values();
+      for (size_t i = 0; i < chunk->count; ++i) {
+        ChunkTraits::destroy(alloc_, values + i);
+      }
+      DestroyChunk(chunk);
+    }
+    tail_ = &head_;
+    size_ = 0;
+  }
+
+  void swap(UnrolledSingleLinkedList &other) noexcept {
+    if constexpr (ChunkTraits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(alloc_, other.alloc_);
+    } else {
+      assert(alloc_ == other.alloc_);
+    }
+    SwapChunks(other);
+  }
+
+  /*
+   * Проверяет списки на равенство, сравнивая непрерывные фрагменты элементов
+   * Фрагменты целых чисел и чисел с плавающей точкой сравниваются векторными
+   * ядрами, фрагменты остальных скалярных типов, например перечислений и
+   * указателей, — через memcmp, а элементы прочих типов — через operator==
+   */
+  [[nodiscard]] bool IsEqualTo(const UnrolledSingleLinkedList &other) const {
+    if (size_ != other.size_) {
+      return false;
+    }
+    bool equal = true;
+    ForEachRunPair(other, [&equal](const Type *lhs, const Type *rhs,
+                                    size_t count) {
+      if constexpr (simd::kIsVectorizable<Type>) {
+        equal = simd::Mismatch(lhs, rhs, count) == count;
+      } else if constexpr (kIsBitwiseComparable) {
+        equal = std::memcmp(lhs, rhs, count * sizeof(Type)) == 0;
+      } else {
+        equal = std::equal(lhs, lhs + count, rhs);
+      }
+      return equal;
+    });
+    return equal;
+  }
+
+  // Выполняет лексикографическое сравнение списков за один проход,
+  // сравнивая элементы непрерывными фрагментами. Для арифметических типов
+  // равные части фрагментов пропускаются векторными ядрами
+  [[nodiscard]] detail::ThreeWayResult CompareWith(
+      const UnrolledSingleLinkedList &other) const {
+    detail::ThreeWayResult result;
+    ForEachRunPair(other, [&result](const Type *lhs, const Type *rhs,
+                                     size_t count) {
+      detail::ThreeWayResult run;
+      if constexpr (simd::kIsVectorizable<Type>) {
+        run = simd::CompareThreeWay(lhs, rhs, count);
+      } else {
+        run = detail::CompareThreeWay(lhs, lhs + count, rhs, rhs + count);
+      }
+      result.equal = result.equal && run.equal;
+      result.order = run.order;
+      return run.order == 0;
+    });
+    if (result.order == 0 && size_ != other.size_) {
+      return {size_ < other.size_ ? -1 : 1, false};
+    }
+    return result;
+  }
+
+  // Возвращает итератор на первый элемент, равный value, или end()
+  // Элементы каждого узла просматриваются векторными ядрами, если Type
+  // допускает их применение
+  [[nodiscard]] Iterator Find(const Type &value) {
+    for (ChunkBase *chunk = head_.next_chunk; chunk != nullptr;
+         chunk = chunk->next_chunk) {
+      const Type *values = static_cast<Chunk *>(chunk)->Values();
+      const size_t index = simd::Find(values, chunk->count, value);
+      if (index < chunk->count) {
+        return Iterator(chunk, index);
+      }
+    }
+    return end();
+  }
+
+  [[nodiscard]] ConstIterator Find(const Type &value) const {
+    return const_cast<UnrolledSingleLinkedList *>(this)->Find(value);
+  }
+
+  // Возвращает количество элементов, равных value
+  [[nodiscard]] size_t Count(const Type &value) const {
+    size_t matches = 0;
+    ForEachChunk([&matches, &value](const Type *values, size_t count) {
+      matches += simd::Count(values, count, value);
+    });
+    return matches;
+  }
+
+  // Вызывает func для каждого непрерывного фрагмента элементов списка.
+  // В func передаются указатель на первый элемент фрагмента и его длина
+  template <typename Func>
+  void ForEachChunk(Func func) const {
+    for (const ChunkBase *chunk = head_.next_chunk; chunk != nullptr;
+         chunk = chunk->next_chunk) {
+      func(static_cast<const Chunk *>(chunk)->Values(), chunk->count);
+    }
+  }
+
+ private:
+  /*
+   * Проходит по элементам двух списков одновременно, передавая в func пары
+   * непрерывных фрагментов равной длины. Проход прекращается, когда func
+   * возвращает false или один из списков заканчивается
+   */
+  template <typename Func>
+  void ForEachRunPair(const UnrolledSingleLinkedList &other, Func func) const {
+    const ChunkBase *lhs_chunk = head_.next_chunk;
+    const ChunkBase *rhs_chunk = other.head_.next_chunk;
+    size_t lhs_index = 0;
+    size_t rhs_index = 0;
+    while (lhs_chunk != nullptr && rhs_chunk != nullptr) {
+      const size_t count = std::min(lhs_chunk->count - lhs_index,
+                                    rhs_chunk->count - rhs_index);
+      const Type *lhs = static_cast<const Chunk *>(lhs_chunk)->Values();
+      const Type *rhs = static_cast<const Chunk *>(rhs_chunk)->Values();
+      if (!func(lhs + lhs_index, rhs + rhs_index, count)) {
+        return;
+      }
+      lhs_index += count;
+      rhs_index += count;
+      if (lhs_index == lhs_chunk->count) {
+        lhs_chunk = lhs_chunk->next_chunk;
+        lhs_index = 0;
+      }
+      if (rhs_index == rhs_chunk->count) {
+        rhs_chunk = rhs_chunk->next_chunk;
+        rhs_index = 0;
+      }
+    }
+  }
+
+  template <typename... Args>
+  void ConstructValue(Chunk *chunk, size_t index, Args &&...args) {
+    ChunkTraits::construct(alloc_, chunk->Values() + index,
+                           std::forward<Args>(args)...);
+  }
+
+  Chunk *CreateChunk() {
+    Chunk *chunk = ChunkTraits::allocate(alloc_, 1);
+    ::new (static_cast<void *>(chunk)) Chunk;
+    return chunk;
+  }
+
+  // Освобождает память узла. Элементы узла должны быть уже разрушены
+  void DestroyChunk(Chunk *chunk) noexcept {
+    chunk->~Chunk();
+    ChunkTraits::deallocate(alloc_, chunk, 1);
+  }
+
+  void LinkChunkAfter(ChunkBase *prev, Chunk *chunk) noexcept {
+    chunk->next_chunk = prev->next_chunk;
+    prev->next_chunk = chunk;
+    if (tail_ == prev) {
+      tail_ = chunk;
+    }
+  }
+
+  // Создаёт после prev новый узел с единственным элементом
+  template <typename... Args>
+  Iterator EmplaceInNewChunk(ChunkBase *prev, Args &&...args) {
+    Chunk *chunk = CreateChunk();
+    try {
+      ConstructValue(chunk, 0, std::forward<Args>(args)...);
+    } catch (...) {
+      DestroyChunk(chunk);
+      throw;
+    }
+    chunk->count = 1;
+    LinkChunkAfter(prev, chunk);
+    ++size_;
+    return Iterator(chunk, 0);
+  }
+
+  // Переносит вторую половину элементов заполненного узла в новый узел,
+  // следующий за ним. Возвращает новый узел
+  Chunk *SplitChunk(Chunk *chunk) {
+    Chunk *second = CreateChunk();
+    const size_t keep = ChunkSize / 2;
+    Type *values = chunk->Values();
+    for (size_t i = keep; i < ChunkSize; ++i) {
+      ConstructValue(second, i - keep, std::move(values[i]));
+      ChunkTraits::destroy(alloc_, values + i);
+    }
+    second->count = ChunkSize - keep;
+    chunk->count = keep;
+    LinkChunkAfter(chunk, second);
+    return second;
+  }
+
+  // Вставляет value в позицию index неполного узла, сдвигая последующие
+  // элементы
+  Iterator InsertIntoChunk(Chunk *chunk, size_t index, Type &&value) {
+    Type *values = chunk->Values();
+    const size_t count = chunk->count;
+    if (index == count) {
+      ConstructValue(chunk, count, std::move(value));
+    } else {
+      ConstructValue(chunk, count, std::move(values[count - 1]));
+      for (size_t i = count - 1; i > index; --i) {
+        values[i] = std::move(values[i - 1]);
+      }
+      values[index] = std::move(value);
+    }
+    ++chunk->count;
+    ++size_;
+    return Iterator(chunk, index);
+  }
+
+  void SwapChunks(UnrolledSingleLinkedList &other) noexcept {
+    std::swap(head_.next_chunk, other.head_.next_chunk);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    if (head_.next_chunk == nullptr) {
+      tail_ = &head_;
+    }
+    if (other.head_.next_chunk == nullptr) {
+      other.tail_ = &other.head_;
+    }
+  }
+
+  ChunkAllocator alloc_;
+  // Фиктивный узел, используется для вставки "перед первым элементом"
+  ChunkBase head_;
+  // Последний узел списка. У пустого списка указывает на head_
+  ChunkBase *tail_ = &head_;
+  size_t size_ = 0;
+};
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+void swap(UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+          UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+bool operator==(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return lhs.IsEqualTo(rhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+bool operator!=(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return !(lhs == rhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+detail::ThreeWayResult CompareThreeWay(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return lhs.CompareWith(rhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+bool operator<(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return detail::IsLess(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+bool operator<=(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return detail::IsLessOrEqual(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+bool operator>(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return detail::IsGreater(CompareThreeWay(lhs, rhs));
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+bool operator>=(
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &lhs,
+    const UnrolledSingleLinkedList<Type, ChunkSize, Allocator> &rhs) {
+  return detail::IsGreaterOrEqual(CompareThreeWay(lhs, rhs));
+}